@@ -0,0 +1,64 @@
+#include "Common.hpp"
+
+#include <cstring>
+#include <embit/CString.hpp>
+
+static void CStringLengthRawLoop(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::size_t length = 0;
+        for (const char* it = str.c_str(); *it != '\0'; ++it) {
+            ++length;
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void CStringLengthStrlen(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto length = std::strlen(str.c_str());
+        benchmark::DoNotOptimize(length);
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void CStringLengthEmbit(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto length = embit::cstring(str.c_str()).size();
+        benchmark::DoNotOptimize(length);
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void CStringSumRawLoop(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        unsigned sum = 0;
+        for (const char* it = str.c_str(); *it != '\0'; ++it) {
+            sum += static_cast<unsigned char>(*it);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void CStringSumEmbit(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        unsigned sum = 0;
+        for (const char c : embit::cstring(str.c_str())) {
+            sum += static_cast<unsigned char>(c);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+BENCHMARK(CStringLengthRawLoop)->Apply(bench::sizes);
+BENCHMARK(CStringLengthStrlen)->Apply(bench::sizes);
+BENCHMARK(CStringLengthEmbit)->Apply(bench::sizes);
+BENCHMARK(CStringSumRawLoop)->Apply(bench::sizes);
+BENCHMARK(CStringSumEmbit)->Apply(bench::sizes);
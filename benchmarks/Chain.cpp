@@ -0,0 +1,65 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+
+// map -> filter -> take over the whole input
+template<class T>
+static void ChainRawLoop(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const bench::Times3<T> f;
+    const bench::IsOdd<T> predicate;
+    const auto amount = data.size() / 4;
+    for (auto _ : state) {
+        T sum{};
+        std::size_t taken = 0;
+        for (const T value : data) {
+            const T mapped = f(value);
+            if (!predicate(mapped)) {
+                continue;
+            }
+            if (taken++ == amount) {
+                break;
+            }
+            sum += mapped;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void ChainEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto amount = static_cast<std::ptrdiff_t>(data.size() / 4);
+    for (auto _ : state) {
+        T sum{};
+        embit::chain(data).map(bench::Times3<T>()).filter(bench::IsOdd<T>()).take(amount).forEach([&sum](const T value) {
+            sum += value;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ChainRawLoop);
+EMBIT_BENCHMARK_TYPES(ChainEmbit);
+
+#ifdef EMBIT_BENCHMARK_HAS_RANGES
+template<class T>
+static void ChainStdRanges(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto amount = data.size() / 4;
+    for (auto _ : state) {
+        T sum{};
+        auto pipeline =
+            data | std::views::transform(bench::Times3<T>()) | std::views::filter(bench::IsOdd<T>()) | std::views::take(amount);
+        for (const T value : pipeline) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ChainStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
@@ -0,0 +1,61 @@
+#include "Common.hpp"
+
+#include <embit/Chunk.hpp>
+
+// Sums the source in blocks of 64 elements, the way a batched consumer would
+static constexpr std::ptrdiff_t chunkSize = 64;
+
+template<class T>
+static void ChunkRawLoop(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t first = 0; first < data.size(); first += chunkSize) {
+            const std::size_t last = first + chunkSize < data.size() ? first + chunkSize : data.size();
+            for (std::size_t i = first; i < last; ++i) {
+                sum += data[i];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void ChunkEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto chunks = embit::chunk(data, chunkSize);
+    for (auto _ : state) {
+        T sum{};
+        for (auto it = chunks.begin(); it != chunks.end(); ++it) {
+            const auto chunk = *it;
+            for (const T* p = chunk.begin(); p != chunk.end(); ++p) {
+                sum += *p;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ChunkRawLoop);
+EMBIT_BENCHMARK_TYPES(ChunkEmbit);
+
+#if defined(EMBIT_BENCHMARK_HAS_RANGES) && defined(__cpp_lib_ranges_chunk)
+template<class T>
+static void ChunkStdRanges(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const auto chunk : data | std::views::chunk(chunkSize)) {
+            for (const T value : chunk) {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ChunkStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
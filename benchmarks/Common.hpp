@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef EMBIT_BENCHMARKS_COMMON_HPP
+#    define EMBIT_BENCHMARKS_COMMON_HPP
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <random>
+#    include <string>
+#    include <vector>
+
+#    if defined(__cpp_lib_ranges)
+#        include <ranges>
+#        define EMBIT_BENCHMARK_HAS_RANGES
+#    endif // __cpp_lib_ranges
+
+namespace bench {
+// Deterministic pseudo random data, so that branchy adaptors (filter) see the same pattern on every run
+template<class T>
+std::vector<T> makeData(const std::size_t size) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(0, 127);
+    std::vector<T> data(size);
+    for (auto& value : data) {
+        value = static_cast<T>(distribution(engine));
+    }
+    return data;
+}
+
+inline std::string makeString(const std::size_t size) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution('a', 'z');
+    std::string str(size, '\0');
+    for (auto& c : str) {
+        c = static_cast<char>(distribution(engine));
+    }
+    return str;
+}
+
+// Reports elements/s, bytes/s and the time spent per element
+inline void setCounters(benchmark::State& state, const std::size_t elements, const std::size_t elementSize) {
+    const auto processed = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(elements);
+    state.SetItemsProcessed(processed);
+    state.SetBytesProcessed(processed * static_cast<std::int64_t>(elementSize));
+    const auto flags = benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert;
+    state.counters["time/element"] = benchmark::Counter(static_cast<double>(elements), flags);
+}
+
+inline void sizes(benchmark::internal::Benchmark* b) {
+    b->Arg(64)->Arg(4096)->Arg(1 << 20);
+}
+
+template<class T>
+struct Times3 {
+    T operator()(const T value) const {
+        return static_cast<T>(value * 3);
+    }
+};
+
+template<class T>
+struct IsOdd {
+    bool operator()(const T value) const {
+        return static_cast<std::int64_t>(value) % 2 != 0;
+    }
+};
+} // namespace bench
+
+#    define EMBIT_BENCHMARK_TYPES(NAME)                                                                                      \
+        BENCHMARK_TEMPLATE(NAME, std::int32_t)->Apply(bench::sizes);                                                         \
+        BENCHMARK_TEMPLATE(NAME, float)->Apply(bench::sizes);                                                                \
+        BENCHMARK_TEMPLATE(NAME, std::uint8_t)->Apply(bench::sizes)
+
+#endif // EMBIT_BENCHMARKS_COMMON_HPP
@@ -0,0 +1,71 @@
+#include "Common.hpp"
+
+#include <embit/Concat.hpp>
+
+// Both halves are concatenated, so the amount of elements equals the benchmark argument
+template<class T>
+static void ConcatRawLoop(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto first = bench::makeData<T>(size / 2);
+    const auto second = bench::makeData<T>(size - size / 2);
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : first) {
+            sum += value;
+        }
+        for (const T value : second) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, size, sizeof(T));
+}
+
+template<class T>
+static void ConcatEmbit(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto first = bench::makeData<T>(size / 2);
+    const auto second = bench::makeData<T>(size - size / 2);
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : embit::concat(first, second)) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, size, sizeof(T));
+}
+
+template<class T>
+static void ConcatEmbitFold(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto first = bench::makeData<T>(size / 2);
+    const auto second = bench::makeData<T>(size - size / 2);
+    for (auto _ : state) {
+        auto sum = embit::concat(first, second)
+                       .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, size, sizeof(T));
+}
+
+// Eight segments, like a frame assembled from several DMA chunks
+template<class T>
+static void ConcatEmbitFoldEightSegments(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::vector<T>> chunks;
+    for (std::size_t i = 0; i < 8; ++i) {
+        chunks.push_back(bench::makeData<T>(size / 8));
+    }
+    for (auto _ : state) {
+        auto sum = embit::concat(chunks[0], chunks[1], chunks[2], chunks[3], chunks[4], chunks[5], chunks[6], chunks[7])
+                       .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, size / 8 * 8, sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ConcatRawLoop);
+EMBIT_BENCHMARK_TYPES(ConcatEmbit);
+EMBIT_BENCHMARK_TYPES(ConcatEmbitFold);
+EMBIT_BENCHMARK_TYPES(ConcatEmbitFoldEightSegments);
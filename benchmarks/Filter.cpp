@@ -0,0 +1,64 @@
+#include "Common.hpp"
+
+#include <embit/Filter.hpp>
+
+template<class T>
+static void FilterRawLoop(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const bench::IsOdd<T> predicate;
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : data) {
+            if (predicate(value)) {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void FilterEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : embit::filter(data, bench::IsOdd<T>())) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void FilterEmbitFold(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto sum = embit::filter(data, bench::IsOdd<T>())
+                       .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(FilterRawLoop);
+EMBIT_BENCHMARK_TYPES(FilterEmbit);
+EMBIT_BENCHMARK_TYPES(FilterEmbitFold);
+
+#ifdef EMBIT_BENCHMARK_HAS_RANGES
+template<class T>
+static void FilterStdRanges(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : data | std::views::filter(bench::IsOdd<T>())) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(FilterStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
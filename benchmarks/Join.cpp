@@ -0,0 +1,50 @@
+#include "Common.hpp"
+
+#include <embit/Join.hpp>
+
+static void JoinRawLoop(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        auto it = str.begin();
+        if (it != str.end()) {
+            out += *it;
+            for (++it; it != str.end(); ++it) {
+                out.append(", ", 2);
+                out += *it;
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void JoinEmbit(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        for (const char c : embit::join(str, ", ")) {
+            out += c;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+static void JoinEmbitCopy(benchmark::State& state) {
+    const auto str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    std::string out;
+    for (auto _ : state) {
+        auto joined = embit::join(str, ", ");
+        out.resize(joined.size());
+        joined.copy(&out[0]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    bench::setCounters(state, str.size(), sizeof(char));
+}
+
+BENCHMARK(JoinRawLoop)->Apply(bench::sizes);
+BENCHMARK(JoinEmbit)->Apply(bench::sizes);
+BENCHMARK(JoinEmbitCopy)->Apply(bench::sizes);
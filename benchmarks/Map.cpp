@@ -0,0 +1,62 @@
+#include "Common.hpp"
+
+#include <embit/Map.hpp>
+
+template<class T>
+static void MapRawLoop(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const bench::Times3<T> f;
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : data) {
+            sum += f(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void MapEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : embit::map(data, bench::Times3<T>())) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void MapEmbitFold(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto sum = embit::map(data, bench::Times3<T>())
+                       .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(MapRawLoop);
+EMBIT_BENCHMARK_TYPES(MapEmbit);
+EMBIT_BENCHMARK_TYPES(MapEmbitFold);
+
+#ifdef EMBIT_BENCHMARK_HAS_RANGES
+template<class T>
+static void MapStdRanges(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : data | std::views::transform(bench::Times3<T>())) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(MapStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
@@ -0,0 +1,29 @@
+#include "Common.hpp"
+
+#include <embit/Map.hpp>
+#include <embit/Parallel.hpp>
+
+template<class T>
+static void ParallelSequentialFold(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto sum = embit::map(data, bench::Times3<T>()).foldl([](const double acc, const T value) { return acc + value; }, 0.0);
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+template<class T>
+static void ParallelReduce(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto sum = embit::parallelFoldl(
+            embit::map(data, bench::Times3<T>()), [](const double acc, const T value) { return acc + value; },
+            [](const double a, const double b) { return a + b; }, 0.0);
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, data.size(), sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ParallelSequentialFold);
+EMBIT_BENCHMARK_TYPES(ParallelReduce);
@@ -0,0 +1,50 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+#include <embit/Range.hpp>
+
+// Sums i * 3 over [0, n) without any backing memory
+template<class T>
+static void RangeRawLoop(benchmark::State& state) {
+    const auto size = static_cast<T>(state.range(0));
+    for (auto _ : state) {
+        T sum{};
+        for (T i = 0; i < size; ++i) {
+            sum += static_cast<T>(i * 3);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(T));
+}
+
+template<class T>
+static void RangeEmbit(benchmark::State& state) {
+    const auto size = static_cast<T>(state.range(0));
+    for (auto _ : state) {
+        const T sum = embit::chain(embit::range(size))
+                          .map(bench::Times3<T>())
+                          .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(RangeRawLoop, std::int32_t)->Apply(bench::sizes);
+BENCHMARK_TEMPLATE(RangeEmbit, std::int32_t)->Apply(bench::sizes);
+
+#ifdef EMBIT_BENCHMARK_HAS_RANGES
+template<class T>
+static void RangeStdRanges(benchmark::State& state) {
+    const auto size = static_cast<T>(state.range(0));
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : std::views::iota(T{}, size) | std::views::transform(bench::Times3<T>())) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(RangeStdRanges, std::int32_t)->Apply(bench::sizes);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
@@ -0,0 +1,92 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+#include <embit/Split.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// Words of 1 to 16 letters separated by spaces
+std::string makeSentence(const std::size_t size) {
+    std::string str = bench::makeString(size);
+    for (std::size_t i = 0; i < str.size(); ++i) {
+        if (str[i] < 'b') {
+            str[i] = ' ';
+        }
+    }
+    return str;
+}
+
+using Token = embit::CStringView<char, embit::detail::CStringIterator<char>>;
+
+struct TokenLength {
+    std::size_t operator()(const Token token) const {
+        return token.size();
+    }
+};
+} // namespace
+
+// Splits a sentence into words one character at a time, the way a hand written tokenizer would
+static void SplitCharLoop(benchmark::State& state) {
+    const std::string str = makeSentence(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::size_t longest = 0;
+        std::size_t length = 0;
+        for (const char c : str) {
+            if (c == ' ') {
+                longest = (std::max)(longest, length);
+                length = 0;
+            }
+            else {
+                ++length;
+            }
+        }
+        benchmark::DoNotOptimize((std::max)(longest, length));
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+static void SplitEmbit(benchmark::State& state) {
+    const std::string str = makeSentence(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        const std::size_t longest = embit::chain(str).split(' ').map(TokenLength()).foldl(
+            [](const std::size_t acc, const std::size_t length) { return (std::max)(acc, length); }, std::size_t{});
+        benchmark::DoNotOptimize(longest);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+// Lines of 80 characters, where the memchr scan has more room to pay off
+static void SplitLinesCharLoop(benchmark::State& state) {
+    std::string str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 79; i < str.size(); i += 80) {
+        str[i] = '\n';
+    }
+    for (auto _ : state) {
+        std::size_t lines = 0;
+        for (const char c : str) {
+            lines += c == '\n';
+        }
+        benchmark::DoNotOptimize(lines);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+static void SplitLinesEmbit(benchmark::State& state) {
+    std::string str = bench::makeString(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 79; i < str.size(); i += 80) {
+        str[i] = '\n';
+    }
+    for (auto _ : state) {
+        const std::size_t lines =
+            embit::chain(str).split('\n').foldl([](const std::size_t acc, const Token) { return acc + 1; }, std::size_t{});
+        benchmark::DoNotOptimize(lines);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+BENCHMARK(SplitCharLoop)->Apply(bench::sizes);
+BENCHMARK(SplitEmbit)->Apply(bench::sizes);
+BENCHMARK(SplitLinesCharLoop)->Apply(bench::sizes);
+BENCHMARK(SplitLinesEmbit)->Apply(bench::sizes);
@@ -0,0 +1,35 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+#include <embit/Stream.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+// Counts one letter in an in memory stream, so that the cost of the source itself is measured rather than the disk
+static void StreamIstreambufIterator(benchmark::State& state) {
+    std::istringstream input(bench::makeString(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        input.clear();
+        input.seekg(0);
+        const auto count = std::count(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>(), 'e');
+        benchmark::DoNotOptimize(count);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+static void StreamEmbit(benchmark::State& state) {
+    std::istringstream input(bench::makeString(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        input.clear();
+        input.seekg(0);
+        const auto count = embit::chain(embit::readStream(input))
+                               .foldl([](const std::ptrdiff_t acc, const char c) { return acc + (c == 'e'); }, std::ptrdiff_t{});
+        benchmark::DoNotOptimize(count);
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(char));
+}
+
+BENCHMARK(StreamIstreambufIterator)->Apply(bench::sizes);
+BENCHMARK(StreamEmbit)->Apply(bench::sizes);
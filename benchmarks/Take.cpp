@@ -0,0 +1,53 @@
+#include "Common.hpp"
+
+#include <embit/Take.hpp>
+
+// Takes half of the source, so both the amount and the end of the source are relevant
+template<class T>
+static void TakeRawLoop(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto amount = data.size() / 2;
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t i = 0; i < amount; ++i) {
+            sum += data[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, amount, sizeof(T));
+}
+
+template<class T>
+static void TakeEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto amount = data.size() / 2;
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : embit::take(data, static_cast<std::ptrdiff_t>(amount))) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, amount, sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(TakeRawLoop);
+EMBIT_BENCHMARK_TYPES(TakeEmbit);
+
+#ifdef EMBIT_BENCHMARK_HAS_RANGES
+template<class T>
+static void TakeStdRanges(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto amount = data.size() / 2;
+    for (auto _ : state) {
+        T sum{};
+        for (const T value : data | std::views::take(amount)) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, amount, sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(TakeStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
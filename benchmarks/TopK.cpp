@@ -0,0 +1,33 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+#include <embit/TopK.hpp>
+
+#include <algorithm>
+#include <functional>
+
+// The 16 greatest values, by collecting and sorting everything as opposed to keeping a heap of 16
+template<class T>
+static void TopKCollectSort(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto all = embit::chain(data).map(bench::Times3<T>()).template collectAs<std::vector<T>>();
+        std::sort(all.begin(), all.end(), std::greater<T>());
+        all.resize((std::min)(all.size(), std::size_t{ 16 }));
+        benchmark::DoNotOptimize(all.data());
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(T));
+}
+
+template<class T>
+static void TopKEmbit(benchmark::State& state) {
+    const auto data = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto top = embit::chain(data).map(bench::Times3<T>()).template topK<16>();
+        benchmark::DoNotOptimize(top.data());
+    }
+    bench::setCounters(state, static_cast<std::size_t>(state.range(0)), sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(TopKCollectSort, std::int32_t)->Apply(bench::sizes);
+BENCHMARK_TEMPLATE(TopKEmbit, std::int32_t)->Apply(bench::sizes);
@@ -0,0 +1,56 @@
+#include "Common.hpp"
+
+#include <embit/Chain.hpp>
+#include <embit/Zip.hpp>
+
+// Dot product of two parallel arrays
+template<class T>
+static void ZipRawLoop(benchmark::State& state) {
+    const auto a = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto b = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            sum += static_cast<T>(a[i] * b[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, a.size(), 2 * sizeof(T));
+}
+
+template<class T>
+static void ZipEmbit(benchmark::State& state) {
+    const auto a = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto b = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        const T sum = embit::chain(a)
+                          .zip(b)
+                          .map([](const std::tuple<const T&, const T&>& row) {
+                              return static_cast<T>(std::get<0>(row) * std::get<1>(row));
+                          })
+                          .foldl([](const T acc, const T value) { return static_cast<T>(acc + value); }, T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, a.size(), 2 * sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ZipRawLoop);
+EMBIT_BENCHMARK_TYPES(ZipEmbit);
+
+#if defined(EMBIT_BENCHMARK_HAS_RANGES) && defined(__cpp_lib_ranges_zip)
+template<class T>
+static void ZipStdRanges(benchmark::State& state) {
+    const auto a = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    const auto b = bench::makeData<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum{};
+        for (const auto [x, y] : std::views::zip(a, b)) {
+            sum += static_cast<T>(x * y);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setCounters(state, a.size(), 2 * sizeof(T));
+}
+
+EMBIT_BENCHMARK_TYPES(ZipStdRanges);
+#endif // EMBIT_BENCHMARK_HAS_RANGES
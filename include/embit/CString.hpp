@@ -5,8 +5,137 @@
 
 #    include "Core.hpp"
 
+#    include <algorithm>
+#    include <cstdint>
+#    include <type_traits>
+
+#    if defined(EMBIT_HAS_AVX2)
+#        include <immintrin.h>
+#    elif defined(EMBIT_HAS_SSE2)
+#        include <emmintrin.h>
+#    endif // EMBIT_HAS_AVX2
+
+#    if defined(_MSC_VER) && (defined(EMBIT_HAS_SSE2) || defined(EMBIT_HAS_AVX2))
+#        include <intrin.h>
+#    endif // _MSC_VER
+
+
 namespace embit {
 namespace detail {
+template<class Char>
+EMBIT_CONSTEXPR_CXX_14 std::size_t strLengthScalar(const Char* s) noexcept {
+    std::size_t length = 0;
+    while (s[length] != Char()) {
+        ++length;
+    }
+    return length;
+}
+
+#    if defined(EMBIT_HAS_SSE2)
+inline unsigned countTrailingZeros(const std::uint32_t mask) noexcept {
+#        if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#        else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#        endif // _MSC_VER
+}
+
+#        if defined(EMBIT_HAS_AVX2)
+constexpr std::size_t simdBlockSize = sizeof(__m256i);
+
+EMBIT_NO_SANITIZE_ADDRESS inline std::uint32_t zeroMask(const char* alignedBlock) noexcept {
+    const auto block = _mm256_load_si256(reinterpret_cast<const __m256i*>(alignedBlock));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_setzero_si256())));
+}
+
+EMBIT_NO_SANITIZE_ADDRESS inline bool groupHasZero(const char* alignedGroup) noexcept {
+    const auto* group = reinterpret_cast<const __m256i*>(alignedGroup);
+    const auto min = _mm256_min_epu8(_mm256_min_epu8(_mm256_load_si256(group), _mm256_load_si256(group + 1)),
+                                     _mm256_min_epu8(_mm256_load_si256(group + 2), _mm256_load_si256(group + 3)));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(min, _mm256_setzero_si256())) != 0;
+}
+#        else
+constexpr std::size_t simdBlockSize = sizeof(__m128i);
+
+EMBIT_NO_SANITIZE_ADDRESS inline std::uint32_t zeroMask(const char* alignedBlock) noexcept {
+    const auto block = _mm_load_si128(reinterpret_cast<const __m128i*>(alignedBlock));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128())));
+}
+
+EMBIT_NO_SANITIZE_ADDRESS inline bool groupHasZero(const char* alignedGroup) noexcept {
+    const auto* group = reinterpret_cast<const __m128i*>(alignedGroup);
+    const auto min = _mm_min_epu8(_mm_min_epu8(_mm_load_si128(group), _mm_load_si128(group + 1)),
+                                  _mm_min_epu8(_mm_load_si128(group + 2), _mm_load_si128(group + 3)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(min, _mm_setzero_si128())) != 0;
+}
+#        endif // EMBIT_HAS_AVX2
+
+constexpr std::size_t simdGroupSize = 4 * simdBlockSize;
+
+// Aligned loads never cross a page boundary, so reading the whole block that contains the terminator is safe even though
+// it may read bytes before `s` or past the terminator
+EMBIT_NO_SANITIZE_ADDRESS inline std::size_t strLengthVectorized(const char* s) noexcept {
+    const auto address = reinterpret_cast<std::uintptr_t>(s);
+    const char* block = reinterpret_cast<const char*>(address & ~static_cast<std::uintptr_t>(simdBlockSize - 1));
+    const auto skip = static_cast<unsigned>(s - block);
+
+    std::uint32_t mask = zeroMask(block) >> skip;
+    if (mask != 0) {
+        return countTrailingZeros(mask);
+    }
+    // Walk single blocks up to a group boundary, then test four blocks per iteration
+    for (block += simdBlockSize; reinterpret_cast<std::uintptr_t>(block) % simdGroupSize != 0; block += simdBlockSize) {
+        mask = zeroMask(block);
+        if (mask != 0) {
+            return static_cast<std::size_t>(block - s) + countTrailingZeros(mask);
+        }
+    }
+    while (!groupHasZero(block)) {
+        block += simdGroupSize;
+    }
+    for (;; block += simdBlockSize) {
+        mask = zeroMask(block);
+        if (mask != 0) {
+            return static_cast<std::size_t>(block - s) + countTrailingZeros(mask);
+        }
+    }
+}
+
+template<class Char>
+inline std::size_t strLengthRuntime(const Char* s, std::true_type /* isByte */) noexcept {
+    return strLengthVectorized(reinterpret_cast<const char*>(s));
+}
+#    else
+template<class Char>
+inline std::size_t strLengthRuntime(const Char* s, std::true_type /* isByte */) noexcept {
+    return strLengthScalar(s);
+}
+#    endif // EMBIT_HAS_SSE2
+
+template<class Char>
+inline std::size_t strLengthRuntime(const Char* s, std::false_type /* isByte */) noexcept {
+    return strLengthScalar(s);
+}
+
+// Returns the amount of characters before the null terminator. Byte sized strings are scanned one SIMD block at a time
+// when SSE2/AVX2 is available (define EMBIT_NO_SIMD to disable this)
+#    ifdef __cpp_lib_is_constant_evaluated
+template<class Char>
+constexpr std::size_t strLength(const Char* s) noexcept {
+    if (std::is_constant_evaluated()) {
+        return strLengthScalar(s);
+    }
+    return strLengthRuntime(s, std::integral_constant<bool, sizeof(Char) == 1>());
+}
+#    else
+template<class Char>
+inline std::size_t strLength(const Char* s) noexcept {
+    return strLengthRuntime(s, std::integral_constant<bool, sizeof(Char) == 1>());
+}
+#    endif // __cpp_lib_is_constant_evaluated
+
 template<class Char>
 class CStringIterator {
     const Char* _iterator{ nullptr };
@@ -25,7 +154,7 @@ public:
 
     CStringIterator() = default;
 
-    const Char* get() const {
+    constexpr const Char* get() const noexcept {
         return _iterator;
     }
 
@@ -66,14 +195,34 @@ public:
         return !(a == b);
     }
 
-    constexpr View<CStringIterator<Char>, CStringIterator<Char>> toCommon() const noexcept {
-        return view(CStringIterator<Char>(_iterator), CStringIterator<Char>(nullptr));
+    EMBIT_CONSTEXPR_CXX_20 View<CStringIterator<Char>, CStringIterator<Char>> toCommon() const noexcept {
+        return view(CStringIterator<Char>(_iterator), CStringIterator<Char>(_iterator + strLength(_iterator)));
     }
 
     constexpr explicit operator bool() const noexcept {
         return static_cast<bool>(_iterator);
     }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        for (const Char* it = _iterator; *it != Char(); ++it) {
+            if (!sink(*it)) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
+
+template<class Char>
+EMBIT_CONSTEXPR_CXX_20 const Char* cstringEnd(const Char* first, DefaultSentinel) noexcept {
+    return first + strLength(first);
+}
+
+template<class Char>
+EMBIT_CONSTEXPR_CXX_20 const Char* cstringEnd(const Char* first, const CStringIterator<Char> last) noexcept {
+    return last.get() ? last.get() : first + strLength(first);
+}
 } // namespace detail
 
 template<class Char, class S>
@@ -91,6 +240,26 @@ public:
     constexpr explicit operator bool() const noexcept {
         return static_cast<bool>(this->begin());
     }
+
+    EMBIT_CONSTEXPR_CXX_20 std::size_t size() const noexcept {
+        const Char* first = this->begin().get();
+        return static_cast<std::size_t>(detail::cstringEnd(first, this->end()) - first);
+    }
+
+    EMBIT_CONSTEXPR_CXX_20 IterDiffType<iterator> distance() const noexcept {
+        return static_cast<IterDiffType<iterator>>(size());
+    }
+
+    template<class OutputIterator>
+    EMBIT_CONSTEXPR_CXX_20 void copy(OutputIterator out) const {
+        const Char* first = this->begin().get();
+        std::copy(first, detail::cstringEnd(first, this->end()), out);
+    }
+
+    template<class Container, class... ContainerArgs>
+    EMBIT_CONSTEXPR_CXX_20 Container collectAs(ContainerArgs&&... args) const {
+        return detail::collect<Container>(*this, std::forward<ContainerArgs>(args)...);
+    }
 };
 
 template<class Char>
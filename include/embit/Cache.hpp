@@ -0,0 +1,332 @@
+#pragma once
+
+#ifndef EMBIT_CACHE_HPP
+#    define EMBIT_CACHE_HPP
+
+#    include "Core.hpp"
+
+#    include <limits>
+#    include <memory>
+#    include <vector>
+
+namespace embit {
+namespace detail {
+// The source is only ever advanced here, so every element is computed exactly once, even when the source is single pass
+template<class Iterator, class Sentinel, class Buffer>
+struct CacheState {
+    Iterator iterator;
+    Sentinel last;
+    Buffer buffer;
+
+    CacheState(Iterator first, Sentinel end, Buffer&& buf) :
+        iterator(std::move(first)),
+        last(std::move(end)),
+        buffer(std::forward<Buffer>(buf)) {
+        buffer.clear();
+    }
+
+    bool fillOne() {
+        if (iterator == last) {
+            return false;
+        }
+        buffer.push_back(*iterator);
+        ++iterator;
+        return true;
+    }
+
+    // Returns false if the source ran out before `index` could be cached
+    bool fillUntil(const std::size_t index) {
+        while (buffer.size() <= index) {
+            if (!fillOne()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::size_t fillAll() {
+        while (fillOne()) {
+        }
+        return buffer.size();
+    }
+};
+
+// A caller provided buffer means the state lives in the view that owns it, otherwise it is shared by all copies
+template<class Iterator, class Sentinel, class Buffer>
+using CacheHandle = Conditional<std::is_lvalue_reference<Buffer>::value, CacheState<Iterator, Sentinel, Buffer>*,
+                                std::shared_ptr<CacheState<Iterator, Sentinel, Buffer>>>;
+
+template<class Iterator, class Sentinel, class Buffer>
+class CacheIterator {
+    using Handle = CacheHandle<Iterator, Sentinel, Buffer>;
+
+    // Forward iterators are bounded by the end of the source, common (or reversed) ones by an index into the buffer
+    static constexpr std::size_t unbounded = (std::numeric_limits<std::size_t>::max)();
+
+    Handle _state{};
+    std::size_t _index{};
+    std::size_t _end{ unbounded };
+
+    std::size_t end() const {
+        return _end == unbounded ? _state->fillAll() : _end;
+    }
+
+public:
+    using value_type = typename RemoveRef<Buffer>::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    CacheIterator(Handle state, const std::size_t index, const std::size_t end) :
+        _state(std::move(state)),
+        _index(index),
+        _end(end) {
+    }
+
+    explicit CacheIterator(Handle state) : _state(std::move(state)) {
+    }
+
+    CacheIterator() = default;
+
+    reference operator*() const {
+        _state->fillUntil(_index);
+        return _state->buffer[_index];
+    }
+
+    pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    CacheIterator& operator++() {
+        ++_index;
+        return *this;
+    }
+
+    CacheIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    CacheIterator& operator--() {
+        --_index;
+        return *this;
+    }
+
+    CacheIterator operator--(int) {
+        auto tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    CacheIterator& operator+=(const difference_type offset) {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + offset);
+        return *this;
+    }
+
+    CacheIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    CacheIterator operator+(const difference_type offset) const {
+        auto tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    CacheIterator operator-(const difference_type offset) const {
+        auto tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    friend CacheIterator operator+(const difference_type offset, const CacheIterator& a) {
+        return a + offset;
+    }
+
+    friend difference_type operator-(const CacheIterator& a, const CacheIterator& b) {
+        return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+    }
+
+    friend difference_type operator-(DefaultSentinel, const CacheIterator& a) {
+        return static_cast<difference_type>(a.end()) - static_cast<difference_type>(a._index);
+    }
+
+    friend difference_type operator-(const CacheIterator& a, DefaultSentinel s) {
+        return -(s - a);
+    }
+
+    friend bool operator<(const CacheIterator& a, const CacheIterator& b) {
+        return a._index < b._index;
+    }
+
+    friend bool operator>(const CacheIterator& a, const CacheIterator& b) {
+        return b < a;
+    }
+
+    friend bool operator<=(const CacheIterator& a, const CacheIterator& b) {
+        return !(b < a);
+    }
+
+    friend bool operator>=(const CacheIterator& a, const CacheIterator& b) {
+        return !(a < b);
+    }
+
+    friend bool operator==(const CacheIterator& a, DefaultSentinel) {
+        return a._end == unbounded ? !a._state->fillUntil(a._index) : a._index == a._end;
+    }
+
+    friend bool operator!=(const CacheIterator& a, DefaultSentinel s) {
+        return !(a == s);
+    }
+
+    friend bool operator==(const CacheIterator& a, const CacheIterator& b) noexcept {
+        return a._index == b._index;
+    }
+
+    friend bool operator!=(const CacheIterator& a, const CacheIterator& b) noexcept {
+        return !(a == b);
+    }
+
+    // Already cached elements are read from the buffer, the remaining ones are computed, cached and pushed one by one
+    template<class Sink>
+    bool forEachWhile(Sink& sink) const {
+        auto& buffer = _state->buffer;
+        for (std::size_t i = _index; i != _end; ++i) {
+            if (i == buffer.size() && !_state->fillOne()) {
+                return true;
+            }
+            if (!sink(buffer[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void swapView() {
+        _end = _index;
+        _index = _state->fillAll();
+    }
+
+    reference back() const {
+        return _state->buffer[end() - 1];
+    }
+
+    std::size_t size() const {
+        return end() - _index;
+    }
+
+    View<CacheIterator, CacheIterator> toCommon() const {
+        const auto last = end();
+        return embit::view(CacheIterator(_state, _index, last), CacheIterator(_state, last, last));
+    }
+};
+} // namespace detail
+
+template<class Iterator, class Sentinel, class Buffer, bool = std::is_lvalue_reference<Buffer>::value>
+class CacheView : public View<detail::CacheIterator<Iterator, Sentinel, Buffer>, DefaultSentinel> {
+public:
+    using iterator = detail::CacheIterator<Iterator, Sentinel, Buffer>;
+    using const_iterator = iterator;
+
+    CacheView(Iterator first, Sentinel last, Buffer&& buffer) :
+        View<iterator, DefaultSentinel>(iterator(std::make_shared<detail::CacheState<Iterator, Sentinel, Buffer>>(
+                                            std::move(first), std::move(last), std::forward<Buffer>(buffer))),
+                                        defaultSentinel) {
+    }
+
+    CacheView() = default;
+
+    // Computes (and caches) all remaining elements
+    std::size_t size() const {
+        return this->begin().size();
+    }
+};
+
+// With a caller provided buffer the source position is stored inline, so nothing is allocated. Like a container, the view
+// must then outlive the iterators and views that are made from it. It can be moved but not copied, as copies would fill
+// the same buffer
+template<class Iterator, class Sentinel, class Buffer>
+class CacheView<Iterator, Sentinel, Buffer, true>
+    : public View<detail::CacheIterator<Iterator, Sentinel, Buffer>, DefaultSentinel> {
+    detail::CacheState<Iterator, Sentinel, Buffer> _state;
+
+public:
+    using iterator = detail::CacheIterator<Iterator, Sentinel, Buffer>;
+    using const_iterator = iterator;
+
+    CacheView(Iterator first, Sentinel last, Buffer&& buffer) :
+        View<iterator, DefaultSentinel>(iterator(&_state), defaultSentinel),
+        _state(std::move(first), std::move(last), std::forward<Buffer>(buffer)) {
+    }
+
+    CacheView(CacheView&& other) :
+        View<iterator, DefaultSentinel>(iterator(&_state), defaultSentinel),
+        _state(std::move(other._state)) {
+    }
+
+    CacheView(const CacheView&) = delete;
+    CacheView& operator=(const CacheView&) = delete;
+
+    std::size_t size() const {
+        return this->begin().size();
+    }
+};
+
+template<class Iterator>
+using DefaultCacheBuffer = std::vector<typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type>;
+
+namespace detail {
+// Used by ChainView, which only declares it so that chain() users don't pay for this header
+template<class Iterator, class Sentinel, class... Buffer>
+struct CacheOf;
+
+template<class Iterator, class Sentinel>
+struct CacheOf<Iterator, Sentinel> {
+    using view = CacheView<Iterator, Sentinel, DefaultCacheBuffer<Iterator>>;
+
+    template<class V>
+    static view make(const V& v) {
+        DefaultCacheBuffer<Iterator> buffer;
+        detail::reserve(buffer, v);
+        return { std::begin(v), std::end(v), std::move(buffer) };
+    }
+};
+
+template<class Iterator, class Sentinel, class Buffer>
+struct CacheOf<Iterator, Sentinel, Buffer> {
+    using view = CacheView<Iterator, Sentinel, Buffer>;
+
+    static_assert(std::is_same<typename RemoveRef<Buffer>::value_type,
+                               typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type>::value,
+                  "value type of the buffer does not match the value type of the view");
+
+    template<class V>
+    static view make(const V& v, Buffer&& buffer) {
+        return { std::begin(v), std::end(v), std::forward<Buffer>(buffer) };
+    }
+};
+} // namespace detail
+
+// Caches the elements of `view` in `buffer` the first time they are visited. Pass an lvalue to let the caller own the
+// storage (e.g. a fixed capacity vector), or an rvalue to move it into the view. The buffer is cleared first and must
+// provide clear(), push_back(), size() and operator[]. References to cached elements stay valid as long as the buffer
+// does not reallocate
+template<class V, class Buffer>
+typename detail::CacheOf<BeginIter<V>, EndIter<V>, Buffer>::view cache(V&& view, Buffer&& buffer) {
+    return detail::CacheOf<BeginIter<V>, EndIter<V>, Buffer>::make(view, std::forward<Buffer>(buffer));
+}
+
+// Caches the elements of `view` in a std::vector, that is reserved up front if the size of `view` is known
+template<class V>
+typename detail::CacheOf<BeginIter<V>, EndIter<V>>::view cache(V&& view) {
+    return detail::CacheOf<BeginIter<V>, EndIter<V>>::make(view);
+}
+} // namespace embit
+
+#endif // EMBIT_CACHE_HPP
@@ -4,15 +4,26 @@
 #    define EMBIT_CHAIN_HPP
 
 #    include "CString.hpp"
+#    include "Chunk.hpp"
 #    include "Core.hpp"
+#    include "Drop.hpp"
 #    include "Filter.hpp"
 #    include "Map.hpp"
+#    include "Probe.hpp"
+#    include "Split.hpp"
 #    include "Take.hpp"
+#    include "TopK.hpp"
+#    include "Zip.hpp"
 
 namespace embit {
 template<class, class>
 class ChainView;
 
+namespace detail {
+template<class Iterator, class Sentinel, class... Buffer>
+struct CacheOf;
+} // namespace detail
+
 template<class V>
 constexpr auto chain(V&& view) -> ChainView<decltype(std::begin(view)), decltype(std::end(view))>;
 
@@ -49,25 +60,112 @@ public:
         return chain(embit::slice(*this, from, to));
     }
 
-    constexpr ChainView<Iterator, DefaultSentinel> skip(const IterDiffType<Iterator> amount) const {
-        return chain(embit::skip(*this, amount));
+    template<class V = typename detail::DropOf<Iterator, Sentinel>::view>
+    EMBIT_CONSTEXPR_CXX_14 ChainView<BeginIter<V>, EndIter<V>> drop(const IterDiffType<Iterator> amount) const {
+        return chain(embit::drop(*this, amount));
+    }
+
+    template<class V = typename detail::DropOf<Iterator, Sentinel>::view>
+    EMBIT_CONSTEXPR_CXX_14 ChainView<BeginIter<V>, EndIter<V>> skip(const IterDiffType<Iterator> amount) const {
+        return chain(embit::drop(*this, amount));
+    }
+
+    constexpr ChainView<detail::ChunkIterator<Iterator, Sentinel>, DefaultSentinel>
+    chunk(const IterDiffType<Iterator> chunkSize) const {
+        return chain(embit::chunk(*this, chunkSize));
     }
 
+    template<class... Vs>
+    constexpr ChainView<detail::ZipIterator<std::tuple<Iterator, BeginIter<Vs>...>, std::tuple<Sentinel, EndIter<Vs>...>>,
+                        DefaultSentinel>
+    zip(Vs&&... views) const {
+        return chain(embit::zip(*this, views...));
+    }
+
+    template<class Char>
+    ChainView<detail::SplitIterator<Char>, DefaultSentinel> split(const Char delimiter) const {
+        return chain(embit::split(*this, delimiter));
+    }
+
+    template<class Char>
+    ChainView<detail::SplitIterator<Char>, DefaultSentinel> split(const Char* delimiter) const {
+        return chain(embit::split(*this, delimiter));
+    }
+
+    template<class Func>
+    ChainView<detail::MapIterator<Iterator, Sentinel, detail::TapFunc<Func>>, DefaultSentinel> tap(Func f) const {
+        return chain(embit::tap(*this, std::move(f)));
+    }
+
+#    ifdef EMBIT_INSTRUMENT
+    ChainView<detail::ProbeIterator<Iterator, Sentinel>, DefaultSentinel> probe(ProbeStats& stats) const {
+        return chain(embit::probe(*this, stats));
+    }
+
+    ChainView<detail::ProbeIterator<Iterator, Sentinel>, DefaultSentinel> probe(const char* name) const {
+        return chain(embit::probe(*this, name));
+    }
+#    else
+    constexpr ChainView<Iterator, Sentinel> probe(ProbeStats&) const {
+        return *this;
+    }
+
+    constexpr ChainView<Iterator, Sentinel> probe(const char*) const {
+        return *this;
+    }
+#    endif // EMBIT_INSTRUMENT
+
     template<class V = ChainView<Iterator, Sentinel>, class B = BeginIter<V>, class E = EndIter<V>>
     detail::EnableIf<!std::is_same<B, E>::value, View<std::reverse_iterator<B>, E>> reverse() const {
         return chain(embit::reverse(*this));
     }
 
     template<class V = ChainView<Iterator, Sentinel>, class B = BeginIter<V>, class E = EndIter<V>>
-    detail::EnableIf<std::is_same<B, E>::value, View<std::reverse_iterator<B>, std::reverse_iterator<B>>> reverse(V&& view) const {
+    detail::EnableIf<std::is_same<B, E>::value, View<std::reverse_iterator<B>, std::reverse_iterator<B>>>
+    reverse(V&& view) const {
         return chain(embit::reverse(*this));
     }
 
+    // cache() requires Cache.hpp
+    template<class C = detail::CacheOf<Iterator, Sentinel>, class V = typename C::view>
+    ChainView<BeginIter<V>, EndIter<V>> cache() const {
+        return chain(C::make(*this));
+    }
+
+    template<class Buffer, class C = detail::CacheOf<Iterator, Sentinel, Buffer>, class V = typename C::view>
+    detail::EnableIf<!std::is_lvalue_reference<Buffer>::value, ChainView<BeginIter<V>, EndIter<V>>> cache(Buffer&& buffer) const {
+        return chain(C::make(*this, std::forward<Buffer>(buffer)));
+    }
+
+    // The view owns the position in the source when the buffer is the caller's, so it is returned rather than chained
+    template<class Buffer, class C = detail::CacheOf<Iterator, Sentinel, Buffer>, class V = typename C::view>
+    detail::EnableIf<std::is_lvalue_reference<Buffer>::value, V> cache(Buffer&& buffer) const {
+        return C::make(*this, buffer);
+    }
+
+    template<std::size_t K, class Compare = detail::Less>
+    EMBIT_CONSTEXPR_CXX_20 StaticVector<detail::TopKValue<Iterator>, K> topK(Compare compare = Compare()) const {
+        return embit::topK<K>(*this, std::move(compare));
+    }
+
+    template<std::size_t K, class Compare = detail::Less>
+    EMBIT_CONSTEXPR_CXX_20 StaticVector<detail::TopKValue<Iterator>, K> bottomK(Compare compare = Compare()) const {
+        return embit::bottomK<K>(*this, std::move(compare));
+    }
+
+    template<class Storage, class Compare = detail::Less>
+    EMBIT_CONSTEXPR_CXX_20 std::size_t topKInto(Storage&& storage, Compare compare = Compare()) const {
+        return embit::topKInto(*this, storage, std::move(compare));
+    }
+
+    template<class Storage, class Compare = detail::Less>
+    EMBIT_CONSTEXPR_CXX_20 std::size_t bottomKInto(Storage&& storage, Compare compare = Compare()) const {
+        return embit::bottomKInto(*this, storage, std::move(compare));
+    }
+
     template<class UnaryOp>
     constexpr const ChainView<Iterator, Sentinel>& forEach(UnaryOp op) const {
-        for (auto&& val : *this) {
-            op(std::forward<decltype(val)>(val));
-        }
+        this->forEachWhile(detail::ForEachSink<UnaryOp>{ op });
         return *this;
     }
 };
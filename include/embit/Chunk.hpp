@@ -0,0 +1,210 @@
+#pragma once
+
+#ifndef EMBIT_CHUNK_HPP
+#    define EMBIT_CHUNK_HPP
+
+#    include "Take.hpp"
+
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+#    if defined(EMBIT_HAS_CXX_20) && defined(__cpp_lib_concepts)
+#        include <concepts>
+#    endif // concepts
+
+namespace embit {
+namespace detail {
+template<class T>
+struct IsCharType : std::false_type {};
+
+template<>
+struct IsCharType<char> : std::true_type {};
+
+template<>
+struct IsCharType<wchar_t> : std::true_type {};
+
+template<>
+struct IsCharType<char16_t> : std::true_type {};
+
+template<>
+struct IsCharType<char32_t> : std::true_type {};
+
+template<class I, class T = typename std::iterator_traits<I>::value_type, bool = IsCharType<T>::value>
+struct IsStringIter : std::false_type {};
+
+template<class I, class T>
+struct IsStringIter<I, T, true>
+    : std::integral_constant<bool, std::is_same<I, typename std::basic_string<T>::iterator>::value ||
+                                       std::is_same<I, typename std::basic_string<T>::const_iterator>::value> {};
+
+template<class I, class T = typename std::iterator_traits<I>::value_type, bool = std::is_same<T, bool>::value>
+struct IsVectorIter : std::integral_constant<bool, std::is_same<I, typename std::vector<T>::iterator>::value ||
+                                                       std::is_same<I, typename std::vector<T>::const_iterator>::value> {};
+
+template<class I, class T>
+struct IsVectorIter<I, T, true> : std::false_type {};
+
+// Iterators whose elements are adjacent in memory, so that a range of them can be handed out as a pair of pointers
+#    if defined(EMBIT_HAS_CXX_20) && defined(__cpp_lib_concepts)
+template<class I>
+struct IsContiguousIter : std::integral_constant<bool, std::contiguous_iterator<I>> {};
+#    else
+template<class I>
+struct IsContiguousIter
+    : std::integral_constant<bool, std::is_pointer<I>::value || IsVectorIter<I>::value || IsStringIter<I>::value> {};
+#    endif
+
+template<class Iterator, bool = IsContiguousIter<Iterator>::value>
+struct ChunkOf {
+    using type = View<Iterator, Iterator>;
+
+    static constexpr type make(const Iterator& first, const Iterator& last) {
+        return embit::view(first, last);
+    }
+};
+
+// Chunks of contiguous sources are pointer ranges, so bulk consumers (memcpy, write(2), SIMD loads) can take them as is
+template<class Iterator>
+struct ChunkOf<Iterator, true> {
+    using pointer = typename std::remove_reference<IterRef<Iterator>>::type*;
+    using type = View<pointer, pointer>;
+
+    static EMBIT_CONSTEXPR_CXX_17 type make(const Iterator& first, const Iterator& last) {
+        const pointer data = std::addressof(*first);
+        return embit::view(data, data + (last - first));
+    }
+};
+
+template<class Iterator, class Sentinel, bool = IsRandomAccessIter<Iterator>::value>
+class ChunkIterator;
+
+// Random access: chunks are addressed by their index, so that every chunk (including the last, shorter one) is found in O(1)
+template<class Iterator, class Sentinel>
+class ChunkIterator<Iterator, Sentinel, true>
+    : public IndexIterator<ChunkIterator<Iterator, Sentinel, true>, typename ChunkOf<Iterator>::type, IterDiffType<Iterator>> {
+    using Chunk = ChunkOf<Iterator>;
+    using Base = IndexIterator<ChunkIterator, typename Chunk::type, IterDiffType<Iterator>>;
+
+public:
+    using value_type = typename Chunk::type;
+    using pointer = void;
+    using typename Base::reference;
+    using typename Base::difference_type;
+
+private:
+    Iterator _first{};
+    difference_type _total{};
+    difference_type _chunkSize{};
+
+public:
+    constexpr ChunkIterator(Iterator first, Sentinel last, const difference_type chunkSize) :
+        Base(0, chunkSize > 0 ? ((last - first) + chunkSize - 1) / chunkSize : 0),
+        _first(first),
+        _total(last - first),
+        _chunkSize(chunkSize) {
+    }
+
+    ChunkIterator() = default;
+
+    EMBIT_CONSTEXPR_CXX_14 reference at(const difference_type index) const {
+        const difference_type offset = index * _chunkSize;
+        const difference_type length = _total - offset < _chunkSize ? _total - offset : _chunkSize;
+        return Chunk::make(_first + offset, _first + (offset + length));
+    }
+};
+
+// Forward: the end of the current chunk is looked up once per increment and kept, so dereferencing stays O(1)
+template<class Iterator, class Sentinel>
+class ChunkIterator<Iterator, Sentinel, false> {
+    Iterator _iterator{};
+    Iterator _chunkEnd{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, ChunkIterator> _last{};
+
+    using Traits = std::iterator_traits<Iterator>;
+
+    static_assert(std::is_convertible<typename Traits::iterator_category, std::forward_iterator_tag>::value,
+                  "Chunking requires the view to be at least multi pass");
+
+public:
+    using value_type = View<Iterator, Iterator>;
+    using reference = value_type;
+    using pointer = void;
+    using difference_type = typename Traits::difference_type;
+    using iterator_category = std::forward_iterator_tag;
+
+private:
+    difference_type _chunkSize{};
+
+public:
+    EMBIT_CONSTEXPR_CXX_14 ChunkIterator(Iterator first, Sentinel last, const difference_type chunkSize) :
+        _iterator(first),
+        _chunkEnd(safeNext(first, last, chunkSize)),
+        _last(std::move(last)),
+        _chunkSize(chunkSize) {
+    }
+
+    ChunkIterator() = default;
+
+    constexpr reference operator*() const {
+        return embit::view(_iterator, _chunkEnd);
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ChunkIterator& operator++() {
+        _iterator = _chunkEnd;
+        _chunkEnd = safeNext(_chunkEnd, _last.get(), _chunkSize);
+        return *this;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ChunkIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    constexpr friend bool operator==(const ChunkIterator& a, DefaultSentinel) noexcept {
+        return a._chunkSize <= 0 || a._iterator == a._last.get();
+    }
+
+    constexpr friend bool operator!=(const ChunkIterator& a, DefaultSentinel s) noexcept {
+        return !(a == s);
+    }
+
+    constexpr friend bool operator==(const ChunkIterator& a, const ChunkIterator& b) noexcept {
+        return a._iterator == b._iterator;
+    }
+
+    constexpr friend bool operator!=(const ChunkIterator& a, const ChunkIterator& b) noexcept {
+        return !(a == b);
+    }
+};
+} // namespace detail
+
+template<class Iterator, class Sentinel>
+class ChunkView : public View<detail::ChunkIterator<Iterator, Sentinel>, DefaultSentinel> {
+public:
+    using iterator = detail::ChunkIterator<Iterator, Sentinel>;
+    using const_iterator = iterator;
+
+    constexpr ChunkView(Iterator first, Sentinel last, const IterDiffType<Iterator> chunkSize) :
+        View<iterator, DefaultSentinel>(iterator(std::move(first), std::move(last), chunkSize), defaultSentinel) {
+    }
+
+    ChunkView() = default;
+
+    template<class I = iterator>
+    constexpr auto size() const -> decltype(std::declval<I>().size()) {
+        return this->begin().size();
+    }
+};
+
+// Splits `view` into consecutive sub views of `chunkSize` elements, the last one holding the remainder. A `chunkSize` of 0
+// or less yields no chunks. Chunks of contiguous sources are views over plain pointers
+template<class V>
+constexpr auto chunk(V&& view, const IterDiffType<BeginIter<V>> chunkSize)
+    -> ChunkView<decltype(std::begin(view)), decltype(std::end(view))> {
+    return { std::begin(view), std::end(view), chunkSize };
+}
+} // namespace embit
+
+#endif // EMBIT_CHUNK_HPP
@@ -5,99 +5,455 @@
 
 #    include "Core.hpp"
 
+#    include <tuple>
+
 namespace embit {
 namespace detail {
-template<class I1, class S1, class I2, class S2>
-class ConcatIterator {
-    I1 _iter1{};
-    S1 _last1{};
-    I2 _iter2{};
-    S2 _last2{};
+template<std::size_t I>
+using IndexConstant = std::integral_constant<std::size_t, I>;
+
+template<class First, class... Rest>
+struct AllSame : std::is_same<std::tuple<First, Rest...>, std::tuple<Rest..., First>> {};
+
+// One entry per segment that applies `Op` to that segment, so that the active segment is reached in one indirect call
+// whatever the amount of segments
+template<class Op, class Indices>
+struct VisitTable;
+
+template<class Op, std::size_t... Is>
+struct VisitTable<Op, std::index_sequence<Is...>> {
+    using Result = decltype(std::declval<const Op&>()(IndexConstant<0>()));
+    using Entry = Result (*)(const Op&);
+
+    template<std::size_t I>
+    static constexpr Result call(const Op& op) {
+        return op(IndexConstant<I>());
+    }
+
+    static constexpr Entry entries[sizeof...(Is)] = { &call<Is>... };
+};
+
+#    ifndef EMBIT_HAS_CXX_17
+template<class Op, std::size_t... Is>
+constexpr typename VisitTable<Op, std::index_sequence<Is...>>::Entry VisitTable<Op, std::index_sequence<Is...>>::entries[];
+#    endif // EMBIT_HAS_CXX_17
 
-    using Traits = std::iterator_traits<I1>;
+// The last element of a segment without moving through it
+template<class Iterator, class Sentinel>
+struct HasSegmentBack
+    : std::integral_constant<bool, HasBack<Iterator>::value ||
+                                       (std::is_same<Iterator, Sentinel>::value && IsBidirectionalIter<Iterator>::value)> {};
+
+template<class Iterator, class Sentinel>
+constexpr EnableIf<!HasBack<Iterator>::value, IterRef<Iterator>> segmentBack(const Iterator&, const Sentinel& last) {
+    return *std::prev(last);
+}
+
+template<class Iterator, class Sentinel>
+constexpr EnableIf<HasBack<Iterator>::value, IterRef<Iterator>> segmentBack(const Iterator& first, const Sentinel&) {
+    return first.back();
+}
+
+template<class Iterators, class Sentinels>
+class ConcatIterator;
+
+// Keeps the position of every segment and the index of the segment that is currently active. Segments before the active
+// one are exhausted and segments after it are at their beginning, so only the active segment needs to be checked
+template<class... Iterators, class... Sentinels>
+class ConcatIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>> {
+    static constexpr std::size_t count = sizeof...(Iterators);
+
+    using FirstIterator = typename std::tuple_element<0, std::tuple<Iterators...>>::type;
+    using Traits = std::iterator_traits<FirstIterator>;
+
+    std::tuple<Iterators...> _firsts{};
+    std::tuple<Iterators...> _iterators{};
+    std::tuple<Sentinels...> _lasts{};
+    std::size_t _index{};
 
 public:
     using value_type = typename Traits::value_type;
-    using reference = typename Traits::reference;
-    using difference_type = typename Traits::difference_type;
+    // Segments that yield different reference types (e.g. a mapped and a plain segment) are read by value
+    using reference = Conditional<AllSame<IterRef<Iterators>...>::value, typename Traits::reference, value_type>;
+    using difference_type = typename std::common_type<IterDiffType<Iterators>...>::type;
     using pointer = typename Traits::pointer;
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = typename std::common_type<std::random_access_iterator_tag, IterCat<Iterators>...>::type;
+
+private:
+    struct Dereference {
+        const ConcatIterator& self;
+
+        template<std::size_t I>
+        constexpr reference operator()(IndexConstant<I>) const {
+            return *std::get<I>(self._iterators);
+        }
+    };
+
+    struct Increment {
+        ConcatIterator& self;
+
+        template<std::size_t I>
+        EMBIT_CONSTEXPR_CXX_14 void operator()(IndexConstant<I>) const {
+            ++std::get<I>(self._iterators);
+        }
+    };
+
+    struct Decrement {
+        ConcatIterator& self;
+
+        template<std::size_t I>
+        EMBIT_CONSTEXPR_CXX_14 void operator()(IndexConstant<I>) const {
+            --std::get<I>(self._iterators);
+        }
+    };
+
+    struct Advance {
+        ConcatIterator& self;
+        difference_type offset;
+
+        template<std::size_t I>
+        EMBIT_CONSTEXPR_CXX_14 void operator()(IndexConstant<I>) const {
+            std::get<I>(self._iterators) += offset;
+        }
+    };
+
+    struct IsAtLast {
+        const ConcatIterator& self;
+
+        template<std::size_t I>
+        constexpr bool operator()(IndexConstant<I>) const {
+            return std::get<I>(self._iterators) == std::get<I>(self._lasts);
+        }
+    };
+
+    struct IsAtFirst {
+        const ConcatIterator& self;
+
+        template<std::size_t I>
+        constexpr bool operator()(IndexConstant<I>) const {
+            return std::get<I>(self._iterators) == std::get<I>(self._firsts);
+        }
+    };
 
-    constexpr ConcatIterator(I1 first1, S1 last1, I2 first2, S2 last2) :
-        _iter1(std::move(first1)),
-        _last1(std::move(last1)),
-        _iter2(std::move(first2)),
-        _last2(std::move(last2)) {
+    struct IsEqual {
+        const ConcatIterator& self;
+        const ConcatIterator& other;
+
+        template<std::size_t I>
+        constexpr bool operator()(IndexConstant<I>) const {
+            return std::get<I>(self._iterators) == std::get<I>(other._iterators);
+        }
+    };
+
+    struct Remaining {
+        const ConcatIterator& self;
+
+        template<std::size_t I>
+        constexpr difference_type operator()(IndexConstant<I>) const {
+            return static_cast<difference_type>(std::get<I>(self._lasts) - std::get<I>(self._iterators));
+        }
+    };
+
+    struct Consumed {
+        const ConcatIterator& self;
+
+        template<std::size_t I>
+        constexpr difference_type operator()(IndexConstant<I>) const {
+            return static_cast<difference_type>(std::get<I>(self._iterators) - std::get<I>(self._firsts));
+        }
+    };
+
+    // Applies `op` to the active segment. Must not be called when all segments are exhausted
+    template<class Op>
+    constexpr auto visit(const Op& op) const -> decltype(op(IndexConstant<0>())) {
+        return VisitTable<Op, std::index_sequence_for<Iterators...>>::entries[_index](op);
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 void skipExhausted() {
+        while (_index != count && visit(IsAtLast{ *this })) {
+            ++_index;
+        }
+    }
+
+    template<class Sink>
+    constexpr bool forEachWhile(Sink&, IndexConstant<count>) const {
+        return true;
+    }
+
+    template<class Sink, std::size_t I>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink, IndexConstant<I>) const {
+        if (I >= _index && !detail::forEachWhile(std::get<I>(_iterators), std::get<I>(_lasts), sink)) {
+            return false;
+        }
+        return forEachWhile(sink, IndexConstant<I + 1>());
+    }
+
+    constexpr difference_type position(IndexConstant<count>) const {
+        return 0;
+    }
+
+    // Sum of the lengths of all segments before the active one, plus the position within the active one
+    template<std::size_t I>
+    EMBIT_CONSTEXPR_CXX_14 difference_type position(IndexConstant<I>) const {
+        if (_index == I) {
+            return Consumed{ *this }(IndexConstant<I>());
+        }
+        return static_cast<difference_type>(std::get<I>(_lasts) - std::get<I>(_firsts)) + position(IndexConstant<I + 1>());
+    }
+
+    constexpr difference_type position() const {
+        return position(IndexConstant<0>());
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 void moveToEnd(IndexConstant<count>) {
+        _index = count;
+    }
+
+    template<std::size_t I>
+    EMBIT_CONSTEXPR_CXX_14 void moveToEnd(IndexConstant<I>) {
+        std::get<I>(_iterators) = std::get<I>(_firsts) + (std::get<I>(_lasts) - std::get<I>(_firsts));
+        moveToEnd(IndexConstant<I + 1>());
+    }
+
+public:
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator(std::tuple<Iterators...> firsts, std::tuple<Sentinels...> lasts) :
+        _firsts(firsts),
+        _iterators(std::move(firsts)),
+        _lasts(std::move(lasts)) {
+        skipExhausted();
     }
 
     ConcatIterator() = default;
 
+    constexpr const std::tuple<Iterators...>& firsts() const noexcept {
+        return _firsts;
+    }
+
+    constexpr const std::tuple<Sentinels...>& lasts() const noexcept {
+        return _lasts;
+    }
+
     constexpr reference operator*() const {
-        if (_iter1 == _last1) {
-            return *_iter2;
+        return visit(Dereference{ *this });
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator& operator++() {
+        visit(Increment{ *this });
+        skipExhausted();
+        return *this;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    // Empty segments are stepped over, segments before the active one are always at their end
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator& operator--() {
+        while (_index == count || visit(IsAtFirst{ *this })) {
+            --_index;
         }
-        return *_iter1;
+        visit(Decrement{ *this });
+        return *this;
     }
 
-    constexpr ConcatIterator& operator++() {
-        if (_iter1 == _last1) {
-            ++_iter2;
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator operator--(int) {
+        auto tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator& operator+=(difference_type offset) {
+        if (offset < 0) {
+            return *this -= -offset;
         }
-        else {
-            ++_iter1;
+        while (offset > 0 && _index != count) {
+            const difference_type remaining = visit(Remaining{ *this });
+            if (offset < remaining) {
+                visit(Advance{ *this, offset });
+                return *this;
+            }
+            visit(Advance{ *this, remaining });
+            offset -= remaining;
+            ++_index;
         }
+        skipExhausted();
         return *this;
     }
 
-    constexpr ConcatIterator operator++(int) {
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator& operator-=(difference_type offset) {
+        if (offset < 0) {
+            return *this += -offset;
+        }
+        while (offset > 0) {
+            if (_index == count || visit(IsAtFirst{ *this })) {
+                --_index;
+                continue;
+            }
+            const difference_type consumed = visit(Consumed{ *this });
+            const difference_type step = offset < consumed ? offset : consumed;
+            visit(Advance{ *this, -step });
+            offset -= step;
+        }
+        return *this;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator operator+(const difference_type offset) const {
         auto tmp(*this);
-        ++*this;
+        tmp += offset;
         return tmp;
     }
 
+    EMBIT_CONSTEXPR_CXX_14 ConcatIterator operator-(const difference_type offset) const {
+        auto tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    constexpr reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    constexpr friend ConcatIterator operator+(const difference_type offset, const ConcatIterator& a) {
+        return a + offset;
+    }
+
+    constexpr friend difference_type operator-(const ConcatIterator& a, const ConcatIterator& b) {
+        return a.position() - b.position();
+    }
+
+    constexpr friend difference_type operator-(DefaultSentinel, const ConcatIterator& a) {
+        return a.size();
+    }
+
+    constexpr friend difference_type operator-(const ConcatIterator& a, DefaultSentinel s) {
+        return -(s - a);
+    }
+
+    constexpr friend bool operator<(const ConcatIterator& a, const ConcatIterator& b) {
+        return a - b < 0;
+    }
+
+    constexpr friend bool operator>(const ConcatIterator& a, const ConcatIterator& b) {
+        return b < a;
+    }
+
+    constexpr friend bool operator<=(const ConcatIterator& a, const ConcatIterator& b) {
+        return !(b < a);
+    }
+
+    constexpr friend bool operator>=(const ConcatIterator& a, const ConcatIterator& b) {
+        return !(a < b);
+    }
+
     constexpr friend bool operator==(const ConcatIterator& a, DefaultSentinel) noexcept {
-        return a._iter2 == a._last2;
+        return a._index == count;
     }
 
     constexpr friend bool operator!=(const ConcatIterator& a, DefaultSentinel s) noexcept {
         return !(a == s);
     }
 
-    constexpr friend bool operator==(const ConcatIterator& a, const ConcatIterator& b) noexcept {
-        if (a._iter1 != b._last1) {
-            return false;
-        }
-        return a._iter2 == b._iter2;
+    constexpr friend bool operator==(const ConcatIterator& a, const ConcatIterator& b) {
+        return a._index == b._index && (a._index == count || a.visit(IsEqual{ a, b }));
     }
 
-    constexpr friend bool operator!=(const ConcatIterator& a, const ConcatIterator& b) noexcept {
+    constexpr friend bool operator!=(const ConcatIterator& a, const ConcatIterator& b) {
         return !(a == b);
     }
+
+    // One loop per segment, starting at the active one
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return forEachWhile(sink, IndexConstant<0>());
+    }
+
+    // Amount of elements left, only the segment lengths are summed
+    template<bool B = AllRandomAccess<Iterators...>::value>
+    constexpr EnableIf<B, difference_type> size() const {
+        return totalSize() - position();
+    }
+
+    template<bool B = AllRandomAccess<Iterators...>::value>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<B, View<ConcatIterator, ConcatIterator>> toCommon() const {
+        auto end(*this);
+        end.moveToEnd(IndexConstant<0>());
+        return embit::view(*this, end);
+    }
+
+    template<bool B = AllRandomAccess<Iterators...>::value>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<B, reference> back() const {
+        auto end(*this);
+        end.moveToEnd(IndexConstant<0>());
+        return *--end;
+    }
+
+    // Other segments can't be moved to their end in O(1), but the last non empty one ends with the last element
+    template<bool B = AllRandomAccess<Iterators...>::value>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<!B && AllOf<HasSegmentBack<Iterators, Sentinels>::value...>::value, reference> back() const {
+        return lastBack(IndexConstant<count - 1>());
+    }
+
+private:
+    constexpr reference lastBack(IndexConstant<0>) const {
+        return segmentBack(std::get<0>(_iterators), std::get<0>(_lasts));
+    }
+
+    // Segments before the active one are exhausted, so searching stops there
+    template<std::size_t I>
+    EMBIT_CONSTEXPR_CXX_14 reference lastBack(IndexConstant<I>) const {
+        if (I > _index && std::get<I>(_iterators) == std::get<I>(_lasts)) {
+            return lastBack(IndexConstant<I - 1>());
+        }
+        return segmentBack(std::get<I>(_iterators), std::get<I>(_lasts));
+    }
+
+    constexpr difference_type totalSize(IndexConstant<count>) const {
+        return 0;
+    }
+
+    template<std::size_t I>
+    constexpr difference_type totalSize(IndexConstant<I>) const {
+        return static_cast<difference_type>(std::get<I>(_lasts) - std::get<I>(_firsts)) + totalSize(IndexConstant<I + 1>());
+    }
+
+    constexpr difference_type totalSize() const {
+        return totalSize(IndexConstant<0>());
+    }
 };
 } // namespace detail
 
-template<class I1, class S1, class I2, class S2>
+template<class Iterators, class Sentinels>
 class ConcatView;
 
-template<class V1, class V2>
-constexpr ConcatView<BeginIter<V1>, EndIter<V1>, BeginIter<V2>, EndIter<V2>> concat(V1&& view1, V2&& view2);
+template<class... Vs>
+constexpr ConcatView<std::tuple<BeginIter<Vs>...>, std::tuple<EndIter<Vs>...>> concat(Vs&&... views);
 
-template<class I1, class S1, class I2, class S2>
-class ConcatView : public embit::View<detail::ConcatIterator<I1, S1, I2, S2>, DefaultSentinel> {
+template<class... Iterators, class... Sentinels>
+class ConcatView<std::tuple<Iterators...>, std::tuple<Sentinels...>>
+    : public View<detail::ConcatIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>>, DefaultSentinel> {
 public:
-    using iterator = detail::ConcatIterator<I1, S1, I2, S2>;
+    using iterator = detail::ConcatIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>>;
     using const_iterator = iterator;
 
-    constexpr ConcatView(I1 first1, S1 last1, I2 first2, S2 last2) :
-        View<iterator, DefaultSentinel>(iterator(std::move(first1), std::move(last1), std::move(first2), std::move(last2)),
-                                        defaultSentinel) {
+    constexpr ConcatView(std::tuple<Iterators...> firsts, std::tuple<Sentinels...> lasts) :
+        View<iterator, DefaultSentinel>(iterator(std::move(firsts), std::move(lasts)), defaultSentinel) {
     }
 
     ConcatView() = default;
 
+    template<class I = iterator>
+    constexpr auto size() const -> decltype(std::declval<I>().size()) {
+        return this->begin().size();
+    }
+
+    // Appends a segment instead of nesting another concat iterator
     template<class V>
-    constexpr ConcatView<iterator, DefaultSentinel, BeginIter<V>, EndIter<V>> concat(V&& view) const {
-        return embit::concat(*this, view);
+    constexpr ConcatView<std::tuple<Iterators..., BeginIter<V>>, std::tuple<Sentinels..., EndIter<V>>> concat(V&& view) const {
+        static_assert(std::is_same<typename iterator::value_type, ViewValueType<V>>::value, "value types do not match");
+        return { std::tuple_cat(this->begin().firsts(), std::make_tuple(std::begin(view))),
+                 std::tuple_cat(this->begin().lasts(), std::make_tuple(std::end(view))) };
     }
 
     template<class V>
@@ -106,15 +462,16 @@ public:
     }
 };
 
-template<class V1, class V2>
-constexpr ConcatView<BeginIter<V1>, EndIter<V1>, BeginIter<V2>, EndIter<V2>> concat(V1&& view1, V2&& view2) {
-    static_assert(std::is_same<ViewValueType<V1>, ViewValueType<V2>>::value, "value types do not match");
-    return { std::begin(view1), std::end(view1), std::begin(view2), std::end(view2) };
+template<class... Vs>
+constexpr ConcatView<std::tuple<BeginIter<Vs>...>, std::tuple<EndIter<Vs>...>> concat(Vs&&... views) {
+    static_assert(sizeof...(Vs) > 0, "at least one view must be concatenated");
+    static_assert(detail::AllSame<ViewValueType<Vs>...>::value, "value types do not match");
+    return { std::make_tuple(std::begin(views)...), std::make_tuple(std::end(views)...) };
 }
 
-template<class V1, class V2>
-constexpr auto constcat(V1&& view1, V2&& view2) -> decltype(concat(detail::asConst(view1), detail::asConst(view2))) {
-    return concat(detail::asConst(view1), detail::asConst(view2));
+template<class... Vs>
+constexpr auto constcat(Vs&&... views) -> decltype(concat(detail::asConst(views)...)) {
+    return concat(detail::asConst(views)...);
 }
 } // namespace embit
 
@@ -3,6 +3,7 @@
 #ifndef EMBIT_VIEW_HPP
 #    define EMBIT_VIEW_HPP
 
+#    include <array>
 #    include <iterator>
 
 #    if defined(__has_cpp_attribute)
@@ -58,10 +59,31 @@
 
 #    if EMBIT_HAS_ATTRIBUTE(no_unique_address)
 #        define EMBIT_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#    elif defined(_MSC_VER) && (_MSC_VER >= 1929)
+#        define EMBIT_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
 #    else
 #        define EMBIT_NO_UNIQUE_ADDRESS
 #    endif
 
+#    if !defined(EMBIT_NO_SIMD)
+#        if defined(__AVX2__)
+#            define EMBIT_HAS_AVX2
+#        endif // __AVX2__
+#        if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#            define EMBIT_HAS_SSE2
+#        endif // __SSE2__
+#    endif // EMBIT_NO_SIMD
+
+#    if defined(__GNUC__) || defined(__clang__)
+#        define EMBIT_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#    else
+#        define EMBIT_NO_SANITIZE_ADDRESS
+#    endif // GNU/clang
+
+#    if defined(__unix__) || defined(__APPLE__)
+#        define EMBIT_HAS_POSIX
+#    endif // POSIX
+
 namespace embit {
 template<class, class>
 class View;
@@ -104,10 +126,15 @@ using ViewRef = typename std::iterator_traits<BeginIter<V>>::reference;
 template<class V>
 using ViewValueType = typename std::iterator_traits<BeginIter<V>>::value_type;
 
-EMBIT_NO_UNIQUE_ADDRESS
 constexpr EMBIT_INLINE_VARIABLE static struct DefaultSentinel {
 } defaultSentinel;
 
+// Outcome of collecting into fixed capacity storage. `truncated` is set if the view had more elements than fit
+struct CollectIntoResult {
+    std::size_t written;
+    bool truncated;
+};
+
 template<class I, class S>
 constexpr View<detail::Decay<I>, detail::Decay<S>> view(I&& first, S&& last);
 
@@ -170,6 +197,10 @@ struct HasToCommon : std::false_type {};
 template<class T>
 struct HasToCommon<T, decltype((void)std::declval<Decay<T>>().toCommon(), 0)> : std::true_type {};
 
+// The iterator type of the common view that `I::toCommon()` returns
+template<class I>
+using CommonIter = decltype(std::begin(std::declval<const I&>().toCommon()));
+
 template<class, class = int>
 struct HasSize : std::false_type {};
 
@@ -186,10 +217,219 @@ template<class, class = int>
 struct HasInsert : std::false_type {};
 
 template<class C>
-struct HasInsert<
-    C, decltype((void)std::declval<Decay<C>>().insert(std::declval<BeginIter<C>>(), std::declval<Decay<C>::value_type>()), 0)>
+struct HasInsert<C,
+                 decltype((void)std::declval<Decay<C>>().insert(std::declval<BeginIter<C>>(),
+                                                                std::declval<typename Decay<C>::value_type>()),
+                          0)> : std::true_type {};
+
+template<class, class = int>
+struct HasPushBack : std::false_type {};
+
+template<class C>
+struct HasPushBack<C, decltype((void)std::declval<Decay<C>>().push_back(std::declval<typename Decay<C>::value_type>()), 0)>
     : std::true_type {};
 
+template<class, class = int>
+struct HasReserve : std::false_type {};
+
+template<class C>
+struct HasReserve<C, decltype((void)std::declval<Decay<C>>().reserve(std::size_t{}), 0)> : std::true_type {};
+
+template<class, class = int>
+struct HasFull : std::false_type {};
+
+template<class C>
+struct HasFull<C, decltype((void)std::declval<Decay<C>>().full(), 0)> : std::true_type {};
+
+template<class>
+struct IsStdArray : std::false_type {};
+
+template<class T, std::size_t N>
+struct IsStdArray<std::array<T, N>> : std::true_type {};
+
+// Storage that cannot grow past a fixed capacity (e.g. StaticVector, std::array or plain arrays). Only positively detected
+// types count, anything else (e.g. std::forward_list) is collected like a growable container
+template<class C>
+struct IsBoundedContainer
+    : std::integral_constant<bool, HasFull<C>::value || std::is_array<C>::value || IsStdArray<Decay<C>>::value> {};
+
+template<class V>
+struct IsSizedView : std::integral_constant<bool, IsRandomAccessView<V>::value || HasSize<V>::value> {};
+
+template<bool...>
+struct BoolPack {};
+
+template<bool... Bs>
+struct AllOf : std::is_same<BoolPack<Bs..., true>, BoolPack<true, Bs...>> {};
+
+template<class... Iterators>
+struct AllRandomAccess : AllOf<IsRandomAccessIter<Iterators>::value...> {};
+
+template<class C, class V, class = int>
+struct IsBulkConstructibleImpl : std::false_type {};
+
+template<class C, class V>
+struct IsBulkConstructibleImpl<
+    C, V, decltype((void)C(std::begin(std::declval<V>().begin().toCommon()), std::end(std::declval<V>().begin().toCommon())), 0)>
+    : std::true_type {};
+
+// Containers that can be constructed from a random access (common) iterator pair allocate only once. Containers that
+// can't be appended to (e.g. std::forward_list) are constructed from any common view
+template<class C, class V>
+struct IsBulkConstructible
+    : Conditional<!IsRandomAccessView<V>::value && (HasPushBack<C>::value || HasInsert<C>::value), std::false_type,
+                  Conditional<std::is_same<BeginIter<V>, EndIter<V>>::value, std::is_constructible<C, BeginIter<V>, EndIter<V>>,
+                              Conditional<HasToCommon<BeginIter<V>>::value, IsBulkConstructibleImpl<C, V>, std::false_type>>> {};
+
+template<class T>
+constexpr AddConst<T>& asConst(T& t) noexcept {
+    return t;
+}
+
+template<class T>
+constexpr AddConst<T>& asConst(T&& t) = delete;
+
+// Holds the end of the range an adaptor iterates over. Empty sentinels (e.g. DefaultSentinel) are not stored: their
+// storage is an empty type that is distinct per owning iterator, so that nested adaptors never need padding to keep
+// sentinels of the same type at different addresses. Only the innermost range end is therefore stored in a pipeline
+template<class Sentinel, class Owner, bool = std::is_empty<Sentinel>::value>
+class SentinelStorage {
+    Sentinel _last{};
+
+public:
+    SentinelStorage() = default;
+
+    constexpr explicit SentinelStorage(Sentinel last) : _last(std::move(last)) {
+    }
+
+    constexpr const Sentinel& get() const noexcept {
+        return _last;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Sentinel& get() noexcept {
+        return _last;
+    }
+};
+
+template<class Sentinel, class Owner>
+class SentinelStorage<Sentinel, Owner, true> {
+public:
+    SentinelStorage() = default;
+
+    constexpr explicit SentinelStorage(Sentinel) noexcept {
+    }
+
+    constexpr Sentinel get() const noexcept {
+        return Sentinel();
+    }
+};
+
+struct AnySink {
+    template<class T>
+    bool operator()(T&&) const;
+};
+
+template<class, class = int>
+struct HasForEachWhile : std::false_type {};
+
+template<class I>
+struct HasForEachWhile<I, decltype((void)std::declval<const Decay<I>&>().forEachWhile(std::declval<AnySink&>()), 0)>
+    : std::true_type {};
+
+template<class OutputIterator>
+struct CopySink {
+    OutputIterator& out;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        *out++ = std::forward<T>(value);
+        return true;
+    }
+};
+
+template<class OutputIterator, class UnaryExpr>
+struct TransformSink {
+    OutputIterator& out;
+    UnaryExpr& expr;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        *out++ = expr(std::forward<T>(value));
+        return true;
+    }
+};
+
+template<class T, class BinaryExpr>
+struct FoldSink {
+    T& accumulator;
+    BinaryExpr& expr;
+
+    template<class U>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(U&& value) const {
+        accumulator = expr(std::move(accumulator), std::forward<U>(value));
+        return true;
+    }
+};
+
+// Sinks that only read the values pushed into them and never stop early, so they may be handed copies instead of references
+// into the source, computed ahead of time
+template<class>
+struct IsValueSink : std::false_type {};
+
+template<class OutputIterator>
+struct IsValueSink<CopySink<OutputIterator>> : std::true_type {};
+
+template<class T, class BinaryExpr>
+struct IsValueSink<FoldSink<T, BinaryExpr>> : std::true_type {};
+
+template<class UnaryOp>
+struct ForEachSink {
+    UnaryOp& op;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        op(std::forward<T>(value));
+        return true;
+    }
+};
+
+template<class Container>
+struct AppendSink {
+    Container& container;
+    CollectIntoResult& result;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        if (container.full()) {
+            result.truncated = true;
+            return false;
+        }
+        container.push_back(std::forward<T>(value));
+        ++result.written;
+        return true;
+    }
+};
+
+template<class OutputIterator>
+struct OverwriteSink {
+    OutputIterator& out;
+    const OutputIterator& last;
+    CollectIntoResult& result;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        if (out == last) {
+            result.truncated = true;
+            return false;
+        }
+        *out = std::forward<T>(value);
+        ++out;
+        ++result.written;
+        return true;
+    }
+};
+
+#    ifndef __cpp_if_constexpr
 template<class V>
 EnableIf<!std::is_same<BeginIter<V>, EndIter<V>>::value, View<std::reverse_iterator<BeginIter<V>>, EndIter<V>>>
 reverse(V&& view) {
@@ -203,7 +443,6 @@ EnableIf<std::is_same<BeginIter<V>, EndIter<V>>::value, View<std::reverse_iterat
     return embit::view(std::reverse_iterator<B>(std::end(view)), std::reverse_iterator<B>(std::begin(view)));
 }
 
-#    ifndef __cpp_if_constexpr
 template<class V>
 constexpr EnableIf<!HasToCommon<BeginIter<V>>::value, V> toCommon(V&& view) {
     return view;
@@ -228,33 +467,95 @@ constexpr EnableIf<!IsRandomAccessIter<I>::value, IterDiffType<I>> distance(I fi
 }
 
 template<class V, class I = BeginIter<V>>
-constexpr EnableIf<IsRandomAccessView<V>::value || HasSize<V>::value, IterDiffType<I>> distance(V&& view) {
+constexpr EnableIf<HasSize<V>::value, IterDiffType<I>> sizeOrCount(V&& view) {
     return static_cast<IterDiffType<I>>(view.size());
 }
 
 template<class V, class I = BeginIter<V>>
-constexpr EnableIf<!IsRandomAccessView<V>::value && !HasSize<V>::value, IterDiffType<I>> distance(V&& view) {
+constexpr EnableIf<!HasSize<V>::value, IterDiffType<I>> sizeOrCount(V&& view) {
     return detail::distance(std::begin(view), std::end(view));
 }
 
-template<class T>
-constexpr AddConst<T>& asConst(T& t) noexcept {
-    return t;
+// Views that know their distance without being sized (e.g. flatten, from the sizes of its inner ranges) are asked for it.
+// Member distance() implementations that have nothing better to offer use sizeOrCount, never the free distance
+template<class V, class I = BeginIter<V>>
+constexpr EnableIf<!HasSize<V>::value && HasDistance<V>::value, IterDiffType<I>> distance(V&& view) {
+    return view.distance();
 }
 
-template<class T>
-constexpr AddConst<T>& asConst(T&& t) = delete;
+template<class V, class I = BeginIter<V>>
+constexpr EnableIf<HasSize<V>::value || !HasDistance<V>::value, IterDiffType<I>> distance(V&& view) {
+    return detail::sizeOrCount(view);
+}
+
+// Internal iteration: adaptors that implement forEachWhile push their elements into `sink` in one loop per segment instead
+// of being driven through operator++/operator!= from the outside. `sink` returns false to stop early
+template<class I, class S, class Sink>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<HasForEachWhile<I>::value && std::is_same<S, DefaultSentinel>::value, bool>
+forEachWhile(const I& first, S, Sink&& sink) {
+    return first.forEachWhile(sink);
+}
+
+template<class I, class S, class Sink>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<!HasForEachWhile<I>::value || !std::is_same<S, DefaultSentinel>::value, bool>
+forEachWhile(I first, const S& last, Sink&& sink) {
+    for (; first != last; ++first) {
+        if (!sink(*first)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class C>
+EnableIf<HasPushBack<C>::value, std::back_insert_iterator<C>> getOutputIterator(C& c) {
+    return std::back_inserter(c);
+}
 
 template<class C>
-EnableIf<HasInsert<C>::value, std::insert_iterator<C>> getOutputIterator(C& c) {
-    return std::inserter(c, std::begin(c));
+EnableIf<!HasPushBack<C>::value && HasInsert<C>::value, std::insert_iterator<C>> getOutputIterator(C& c) {
+    return std::inserter(c, std::end(c));
 }
 
 template<class C>
-auto getOutputIterator(C& c) -> EnableIf<!HasInsert<C>::value, decltype(std::begin(c))> {
+auto getOutputIterator(C& c) -> EnableIf<!HasPushBack<C>::value && !HasInsert<C>::value, decltype(std::begin(c))> {
     return std::begin(c);
 }
 
+template<class C, class V>
+EnableIf<HasReserve<C>::value && IsSizedView<V>::value> reserve(C& c, const V& view) {
+    c.reserve(static_cast<std::size_t>(embit::distance(view)));
+}
+
+template<class C, class V>
+EnableIf<!HasReserve<C>::value || !IsSizedView<V>::value> reserve(C&, const V&) {
+}
+
+template<class C, class V>
+EnableIf<std::is_same<BeginIter<V>, EndIter<V>>::value, C> collectCommon(const V& view) {
+    return C(std::begin(view), std::end(view));
+}
+
+template<class C, class V>
+EnableIf<!std::is_same<BeginIter<V>, EndIter<V>>::value, C> collectCommon(const V& view) {
+    const auto common = std::begin(view).toCommon();
+    return C(std::begin(common), std::end(common));
+}
+
+template<class C, class V>
+EnableIf<IsBulkConstructible<C, V>::value && !IsBoundedContainer<C>::value, C> collect(const V& view) {
+    return collectCommon<C>(view);
+}
+
+template<class C, class V, class... Args>
+EnableIf<(!IsBulkConstructible<C, V>::value || (sizeof...(Args) > 0)) && !IsBoundedContainer<C>::value, C>
+collect(const V& view, Args&&... args) {
+    C c(std::forward<Args>(args)...);
+    detail::reserve(c, view);
+    view.copy(detail::getOutputIterator(c));
+    return c;
+}
+
 #    else
 template<class V>
 constexpr decltype(auto) toCommon(V&& view) {
@@ -280,9 +581,9 @@ constexpr IterDiffType<I> distance(I first, S last) {
 }
 
 template<class V>
-constexpr IterDiffType<BeginIter<V>> distance(V&& view) {
+constexpr IterDiffType<BeginIter<V>> sizeOrCount(V&& view) {
     using C = IterDiffType<BeginIter<V>>;
-    if constexpr (IsRandomAccessView<V>::value || (HasSize<V>::value && !HasDistance<V>::value)) {
+    if constexpr (HasSize<V>::value) {
         return static_cast<C>(view.size());
     }
     else {
@@ -290,16 +591,74 @@ constexpr IterDiffType<BeginIter<V>> distance(V&& view) {
     }
 }
 
+// Views that know their distance without being sized (e.g. flatten, from the sizes of its inner ranges) are asked for it.
+// Member distance() implementations that have nothing better to offer use sizeOrCount, never the free distance
+template<class V>
+constexpr IterDiffType<BeginIter<V>> distance(V&& view) {
+    if constexpr (!HasSize<V>::value && HasDistance<V>::value) {
+        return view.distance();
+    }
+    else {
+        return detail::sizeOrCount(view);
+    }
+}
+
+// Internal iteration: adaptors that implement forEachWhile push their elements into `sink` in one loop per segment instead
+// of being driven through operator++/operator!= from the outside. `sink` returns false to stop early
+template<class I, class S, class Sink>
+constexpr bool forEachWhile(I first, const S& last, Sink&& sink) {
+    if constexpr (HasForEachWhile<I>::value && std::is_same_v<S, DefaultSentinel>) {
+        return first.forEachWhile(sink);
+    }
+    else {
+        for (; first != last; ++first) {
+            if (!sink(*first)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
 template<class C>
 auto getOutputIterator(C& c) {
-    if constexpr (HasInsert<C>::value) {
-        return std::inserter(c, std::begin(c));
+    if constexpr (HasPushBack<C>::value) {
+        return std::back_inserter(c);
+    }
+    else if constexpr (HasInsert<C>::value) {
+        return std::inserter(c, std::end(c));
     }
     else {
         return std::begin(c);
     }
 }
 
+template<class C, class V>
+EMBIT_CONSTEXPR_CXX_20 void reserve(C& c, const V& view) {
+    if constexpr (HasReserve<C>::value && IsSizedView<V>::value) {
+        c.reserve(static_cast<std::size_t>(embit::distance(view)));
+    }
+}
+
+template<class C, class V, class... Args>
+EMBIT_CONSTEXPR_CXX_20 EnableIf<!IsBoundedContainer<C>::value, C> collect(const V& view, Args&&... args) {
+    if constexpr (sizeof...(Args) == 0 && IsBulkConstructible<C, V>::value) {
+        if constexpr (std::is_same_v<BeginIter<V>, EndIter<V>>) {
+            return C(std::begin(view), std::end(view));
+        }
+        else {
+            const auto common = std::begin(view).toCommon();
+            return C(std::begin(common), std::end(common));
+        }
+    }
+    else {
+        C c(std::forward<Args>(args)...);
+        detail::reserve(c, view);
+        view.copy(detail::getOutputIterator(c));
+        return c;
+    }
+}
+
 template<class V>
 auto reverse(V&& view) {
     using B = BeginIter<V>;
@@ -314,6 +673,33 @@ auto reverse(V&& view) {
     }
 }
 #    endif
+
+// Containers with a fixed capacity are appended to until they are full, other storage is overwritten from its beginning
+template<class V, class C>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<HasFull<C>::value, CollectIntoResult> collectInto(const V& view, C& container) {
+    CollectIntoResult result{ 0, false };
+    detail::forEachWhile(view.begin(), view.end(), AppendSink<C>{ container, result });
+    return result;
+}
+
+template<class V, class C>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<!HasFull<C>::value, CollectIntoResult> collectInto(const V& view, C& storage) {
+    CollectIntoResult result{ 0, false };
+    auto out = std::begin(storage);
+    const auto last = std::end(storage);
+    detail::forEachWhile(view.begin(), view.end(), OverwriteSink<decltype(out)>{ out, last, result });
+    return result;
+}
+
+// Fixed capacity containers are value initialized and filled without allocating, excess elements are dropped
+template<class C, class V, class... Args>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<IsBoundedContainer<C>::value, C> collect(const V& view, Args&&...) {
+    static_assert(sizeof...(Args) == 0,
+                  "fixed capacity containers are value initialized, constructor arguments are not supported");
+    C c{};
+    detail::collectInto(view, c);
+    return c;
+}
 } // namespace detail
 
 template<class V>
@@ -373,18 +759,19 @@ public:
         return _last;
     }
 
+    template<class Sink>
+    constexpr bool forEachWhile(Sink&& sink) const {
+        return detail::forEachWhile(_first, _last, sink);
+    }
+
     template<class OutputIterator>
     constexpr void copy(OutputIterator out) const {
-        for (auto&& i : *this) {
-            *out++ = i;
-        }
+        detail::forEachWhile(_first, _last, detail::CopySink<OutputIterator>{ out });
     }
 
     template<class OutputIterator, class UnaryExpr>
     constexpr void transform(OutputIterator out, UnaryExpr&& f) const {
-        for (auto&& i : *this) {
-            *out++ = f(std::forward<decltype(i)>(i));
-        }
+        detail::forEachWhile(_first, _last, detail::TransformSink<OutputIterator, detail::RemoveRef<UnaryExpr>>{ out, f });
     }
 
     template<class OutputIterator>
@@ -394,15 +781,19 @@ public:
 
     template<class Container, class... ContainerArgs>
     constexpr Container collectAs(ContainerArgs&&... args) const {
-        Container c(std::forward<ContainerArgs>(args)...);
-        const auto outputIter = detail::getOutputIterator(c);
-        copy(outputIter);
-        return c;
+        return detail::collect<Container>(*this, std::forward<ContainerArgs>(args)...);
+    }
+
+    // Writes the elements into caller provided storage without allocating, see CollectIntoResult for what did not fit
+    template<class Container>
+    constexpr CollectIntoResult collectInto(Container&& storage) const {
+        return detail::collectInto(*this, storage);
     }
 
     template<class Container, class UnaryExpr, class... ContainerArgs>
     constexpr Container transformCollectAs(UnaryExpr&& expr, ContainerArgs&&... args) const {
         Container c(std::forward<ContainerArgs>(args)...);
+        detail::reserve(c, *this);
         const auto outputIter = detail::getOutputIterator(c);
         this->transform(outputIter, std::forward<UnaryExpr>(expr));
         return c;
@@ -410,9 +801,7 @@ public:
 
     template<class T, class BinaryExpr>
     constexpr T foldl(BinaryExpr&& expr, T init) const {
-        for (const auto& item : *this) {
-            init = expr(std::move(init), item);
-        }
+        detail::forEachWhile(_first, _last, detail::FoldSink<T, detail::RemoveRef<BinaryExpr>>{ init, expr });
         return init;
     }
 
@@ -435,7 +824,7 @@ public:
     }
 
     constexpr IterDiffType<Iterator> distance() const {
-        return embit::distance(*this);
+        return detail::sizeOrCount(*this);
     }
 };
 
@@ -449,16 +838,173 @@ constexpr View<BeginIter<V>, EndIter<V>> view(V&& view) {
     return embit::view(std::begin(view), std::end(view));
 }
 
-template<class V>
-EMBIT_CONSTEXPR_CXX_17 View<BeginIter<V>, EndIter<V>> skip(V&& view, const IterDiffType<BeginIter<V>> offset) {
-    return embit::view(std::next(std::begin(view), offset), offset);
-}
-
 template<class V>
 constexpr IterDiffType<BeginIter<V>> distance(V&& view) {
     return detail::distance(view);
 }
 
+namespace detail {
+// Base of random access iterators that address their elements by an index into [index, end), so that only dereferencing
+// is left to `Derived`, through `reference at(difference_type) const`. Reversing swaps the indices: the iterator moves to
+// the end and counts back towards the beginning, which is what reverse iteration compares against
+template<class Derived, class Reference, class DiffType>
+class IndexIterator {
+public:
+    using reference = Reference;
+    using difference_type = DiffType;
+    using iterator_category = std::random_access_iterator_tag;
+
+protected:
+    difference_type _index{};
+    // The index that compares equal to the sentinel
+    difference_type _end{};
+
+    constexpr IndexIterator(const difference_type index, const difference_type end) noexcept : _index(index), _end(end) {
+    }
+
+    IndexIterator() = default;
+
+    EMBIT_CONSTEXPR_CXX_14 Derived& derived() noexcept {
+        return static_cast<Derived&>(*this);
+    }
+
+    constexpr const Derived& derived() const noexcept {
+        return static_cast<const Derived&>(*this);
+    }
+
+public:
+    constexpr reference operator*() const {
+        return derived().at(_index);
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived& operator++() noexcept {
+        ++_index;
+        return derived();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived operator++(int) noexcept {
+        auto tmp(derived());
+        ++*this;
+        return tmp;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived& operator--() noexcept {
+        --_index;
+        return derived();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived operator--(int) noexcept {
+        auto tmp(derived());
+        --*this;
+        return tmp;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived& operator+=(const difference_type offset) noexcept {
+        _index += offset;
+        return derived();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived& operator-=(const difference_type offset) noexcept {
+        _index -= offset;
+        return derived();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived operator+(const difference_type offset) const noexcept {
+        auto tmp(derived());
+        tmp += offset;
+        return tmp;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 Derived operator-(const difference_type offset) const noexcept {
+        auto tmp(derived());
+        tmp -= offset;
+        return tmp;
+    }
+
+    constexpr reference operator[](const difference_type offset) const {
+        return derived().at(_index + offset);
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend Derived operator+(const difference_type offset, const Derived& a) noexcept {
+        return a + offset;
+    }
+
+    constexpr friend difference_type operator-(const Derived& a, const Derived& b) noexcept {
+        return a._index - b._index;
+    }
+
+    constexpr friend difference_type operator-(DefaultSentinel, const Derived& a) noexcept {
+        return a._end - a._index;
+    }
+
+    constexpr friend difference_type operator-(const Derived& a, DefaultSentinel s) noexcept {
+        return -(s - a);
+    }
+
+    constexpr friend bool operator<(const Derived& a, const Derived& b) noexcept {
+        return a._index < b._index;
+    }
+
+    constexpr friend bool operator>(const Derived& a, const Derived& b) noexcept {
+        return b < a;
+    }
+
+    constexpr friend bool operator<=(const Derived& a, const Derived& b) noexcept {
+        return !(b < a);
+    }
+
+    constexpr friend bool operator>=(const Derived& a, const Derived& b) noexcept {
+        return !(a < b);
+    }
+
+    constexpr friend bool operator==(const Derived& a, DefaultSentinel) noexcept {
+        return a._index == a._end;
+    }
+
+    constexpr friend bool operator!=(const Derived& a, DefaultSentinel s) noexcept {
+        return !(a == s);
+    }
+
+    constexpr friend bool operator==(const Derived& a, const Derived& b) noexcept {
+        return a._index == b._index;
+    }
+
+    constexpr friend bool operator!=(const Derived& a, const Derived& b) noexcept {
+        return !(a == b);
+    }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        for (difference_type i = _index; i != _end; ++i) {
+            if (!sink(derived().at(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 void swapView() noexcept {
+        const difference_type first = _index;
+        _index = _end;
+        _end = first;
+    }
+
+    constexpr reference back() const {
+        return derived().at(_end - 1);
+    }
+
+    constexpr difference_type size() const noexcept {
+        return _end - _index;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 View<Derived, Derived> toCommon() const {
+        auto last(derived());
+        last._index = _end;
+        return embit::view(derived(), std::move(last));
+    }
+};
+} // namespace detail
+
 template<class I>
 EMBIT_CONSTEXPR_CXX_17 bool operator==(const std::reverse_iterator<I>& it, DefaultSentinel s) noexcept {
     return it.base() == s;
@@ -469,6 +1015,16 @@ EMBIT_CONSTEXPR_CXX_17 bool operator!=(const std::reverse_iterator<I>& it, Defau
     return !(it == s);
 }
 
+template<class I>
+constexpr IterDiffType<I> operator-(DefaultSentinel s, const std::reverse_iterator<I>& it) {
+    return it.base() - s;
+}
+
+template<class I>
+constexpr IterDiffType<I> operator-(const std::reverse_iterator<I>& it, DefaultSentinel s) {
+    return -(s - it);
+}
+
 template<class V>
 constexpr auto toCommon(V&& view) -> decltype(detail::toCommon(view)) {
     return detail::toCommon(view);
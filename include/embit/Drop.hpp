@@ -0,0 +1,151 @@
+#pragma once
+
+#ifndef EMBIT_DROP_HPP
+#    define EMBIT_DROP_HPP
+
+#    include "Take.hpp"
+
+namespace embit {
+namespace detail {
+// Forward (or weaker): the first `count` elements are skipped on first use rather than on construction, so that building a
+// pipeline (or wrapping the view in a chain() or another adaptor) doesn't pay for it. The first increment skips them and
+// keeps the position; a dereference or comparison before that walks a copy, so const iterators are never written to
+template<class Iterator, class Sentinel>
+class DropIterator {
+    Iterator _iterator{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, DropIterator> _last{};
+
+    using Traits = std::iterator_traits<Iterator>;
+
+public:
+    using value_type = typename Traits::value_type;
+    using reference = typename Traits::reference;
+    using pointer = typename Traits::pointer;
+    using difference_type = typename Traits::difference_type;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename Traits::iterator_category>::type;
+
+private:
+    difference_type _pending{};
+
+    EMBIT_CONSTEXPR_CXX_14 Iterator current() const {
+        return _pending > 0 ? safeNext(_iterator, _last.get(), _pending) : _iterator;
+    }
+
+public:
+    constexpr DropIterator(Iterator first, Sentinel last, const difference_type count) :
+        _iterator(std::move(first)),
+        _last(std::move(last)),
+        _pending(count) {
+    }
+
+    DropIterator() = default;
+
+    EMBIT_CONSTEXPR_CXX_14 reference operator*() const {
+        return *current();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 DropIterator& operator++() {
+        if (_pending > 0) {
+            _iterator = safeNext(std::move(_iterator), _last.get(), _pending);
+            _pending = 0;
+        }
+        ++_iterator;
+        return *this;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 DropIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator==(const DropIterator& a, DefaultSentinel) {
+        return a.current() == a._last.get();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator!=(const DropIterator& a, DefaultSentinel s) {
+        return !(a == s);
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator==(const DropIterator& a, const DropIterator& b) {
+        return a.current() == b.current();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator!=(const DropIterator& a, const DropIterator& b) {
+        return !(a == b);
+    }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        return detail::forEachWhile(current(), _last.get(), sink);
+    }
+
+    template<class I = Iterator>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<!HasToCommon<I>::value, View<DropIterator<I, I>, DropIterator<I, I>>> toCommon() const {
+        using It = DropIterator<I, I>;
+        return embit::view(It(current(), _last.get(), 0), It(_last.get(), _last.get(), 0));
+    }
+
+    template<class I = Iterator, class C = CommonIter<I>>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<HasToCommon<I>::value, View<DropIterator<C, C>, DropIterator<C, C>>> toCommon() const {
+        using It = DropIterator<C, C>;
+        auto v = current().toCommon();
+        auto begin = std::begin(v);
+        auto end = std::end(v);
+        return embit::view(It(std::move(begin), end, 0), It(end, end, 0));
+    }
+};
+} // namespace detail
+
+template<class Iterator, class Sentinel>
+class DropView : public View<detail::DropIterator<Iterator, Sentinel>, DefaultSentinel> {
+public:
+    using iterator = detail::DropIterator<Iterator, Sentinel>;
+    using const_iterator = iterator;
+
+    constexpr DropView(Iterator first, Sentinel last, const IterDiffType<Iterator> count) :
+        View<iterator, DefaultSentinel>(iterator(std::move(first), std::move(last), count), defaultSentinel) {
+    }
+
+    DropView() = default;
+};
+
+namespace detail {
+template<class Iterator, class Sentinel, bool = IsRandomAccessIter<Iterator>::value>
+struct DropOf {
+    using view = DropView<Iterator, Sentinel>;
+
+    static constexpr view make(Iterator first, Sentinel last, const IterDiffType<Iterator> count) {
+        return { std::move(first), std::move(last), count };
+    }
+};
+
+// Random access: the new beginning is computed in O(1) and the view keeps its iterators, so its category and size. A
+// negative count drops nothing
+template<class Iterator, class Sentinel>
+struct DropOf<Iterator, Sentinel, true> {
+    using view = View<Iterator, Sentinel>;
+
+    static EMBIT_CONSTEXPR_CXX_14 view make(Iterator first, Sentinel last, const IterDiffType<Iterator> count) {
+        auto begin = safeNext(std::move(first), last, count < 0 ? 0 : count);
+        return embit::view(std::move(begin), std::move(last));
+    }
+};
+} // namespace detail
+
+// Drops the first `count` elements of `view`, or all of them if it has fewer. O(1) on random access views; on other views
+// the elements are skipped lazily, when the view is first iterated
+template<class V>
+EMBIT_CONSTEXPR_CXX_14 typename detail::DropOf<BeginIter<V>, EndIter<V>>::view
+drop(V&& view, const IterDiffType<BeginIter<V>> count) {
+    return detail::DropOf<BeginIter<V>, EndIter<V>>::make(std::begin(view), std::end(view), count);
+}
+
+template<class V>
+EMBIT_CONSTEXPR_CXX_14 typename detail::DropOf<BeginIter<V>, EndIter<V>>::view
+skip(V&& view, const IterDiffType<BeginIter<V>> count) {
+    return embit::drop(std::forward<V>(view), count);
+}
+} // namespace embit
+
+#endif // EMBIT_DROP_HPP
@@ -5,18 +5,50 @@
 
 #    include "FunctionWrapper.hpp"
 
+#    ifndef EMBIT_FILTER_BATCH_SIZE
+#        define EMBIT_FILTER_BATCH_SIZE 64
+#    endif // EMBIT_FILTER_BATCH_SIZE
+
 namespace embit {
 namespace detail {
+template<class Func, class T, class = int>
+struct IsConstPredicate : std::false_type {};
+
+template<class Func, class T>
+struct IsConstPredicate<Func, T, decltype((void)std::declval<const Func&>()(std::declval<const T&>()), 0)> : std::true_type {};
+
+// Arithmetic random access sources are filtered a batch at a time. The predicate is evaluated for every element of the batch
+// and survivors are compacted into a local buffer without branching, which the compiler can vectorize. This is only done
+// when it is unobservable: the sink only reads copies and consumes every element, so that no predicate call is wasted on
+// elements past where it would stop, and the predicate can't modify the elements it is given
+template<class Iterator, class Sink, class Func>
+struct IsFilterBatchable
+    : std::integral_constant<bool, IsRandomAccessIter<Iterator>::value &&
+                                       std::is_arithmetic<typename std::iterator_traits<Iterator>::value_type>::value &&
+                                       IsValueSink<Sink>::value &&
+                                       IsConstPredicate<Func, typename std::iterator_traits<Iterator>::value_type>::value> {};
+
+template<class Func, class Sink>
+struct FilterSink {
+    Func& f;
+    Sink& sink;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        return !f(value) || sink(std::forward<T>(value));
+    }
+};
+
 template<class Iterator, class Sentinel, class Func>
 class FilterIterator {
     Iterator _iterator{};
-    Sentinel _last{};
-    mutable detail::FunctionWrapper<Func> _f{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, FilterIterator> _last{};
+    EMBIT_NO_UNIQUE_ADDRESS detail::FunctionWrapper<Func> _f{};
 
     using Traits = std::iterator_traits<Iterator>;
 
     constexpr void find() {
-        while (_iterator != _last) {
+        while (_iterator != _last.get()) {
             if (_f(*_iterator)) break;
             ++_iterator;
         }
@@ -25,7 +57,8 @@ class FilterIterator {
 public:
     using reference = typename Traits::reference;
     using value_type = typename Traits::value_type;
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_category =
+        typename std::common_type<std::bidirectional_iterator_tag, typename Traits::iterator_category>::type;
     using difference_type = typename Traits::difference_type;
     using pointer = typename Traits::pointer;
 
@@ -55,7 +88,7 @@ public:
     }
 
     constexpr FilterIterator& operator--() {
-        while (_iterator != _last) {
+        while (_iterator != _last.get()) {
             --_iterator;
             if (_f(*_iterator)) break;
         }
@@ -64,12 +97,12 @@ public:
 
     constexpr FilterIterator operator--(int) {
         auto tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 
     constexpr friend bool operator==(const FilterIterator& a, DefaultSentinel) noexcept {
-        return a._iterator == a._last;
+        return a._iterator == a._last.get();
     }
 
     constexpr friend bool operator!=(const FilterIterator& a, DefaultSentinel s) noexcept {
@@ -84,22 +117,66 @@ public:
         return !(a == b);
     }
 
+private:
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhileImpl(Sink& sink, std::false_type /* isBatchable */) const {
+        return detail::forEachWhile(_iterator, _last.get(), FilterSink<const FunctionWrapper<Func>, Sink>{ _f, sink });
+    }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhileImpl(Sink& sink, std::true_type /* isBatchable */) const {
+        constexpr difference_type batchSize = EMBIT_FILTER_BATCH_SIZE;
+        value_type survivors[batchSize]{};
+
+        auto first = _iterator;
+        for (auto remaining = _last.get() - first; remaining > 0;) {
+            const auto size = remaining < batchSize ? remaining : batchSize;
+            difference_type count = 0;
+            for (difference_type i = 0; i < size; ++i) {
+                const value_type& element = first[i];
+                survivors[count] = element;
+                count += static_cast<bool>(_f(element));
+            }
+            for (difference_type i = 0; i < count; ++i) {
+                if (!sink(survivors[i])) {
+                    return false;
+                }
+            }
+            first += size;
+            remaining -= size;
+        }
+        return true;
+    }
+
+public:
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return forEachWhileImpl(sink, IsFilterBatchable<Iterator, Sink, FunctionWrapper<Func>>());
+    }
+
+    EMBIT_CONSTEXPR_CXX_20 reference back() const {
+        auto tmp(*this);
+        tmp.swapView();
+        return *--tmp;
+    }
+
 #    ifdef __cpp_if_constexpr
     EMBIT_CONSTEXPR_CXX_20 void swapView() noexcept {
-        if constexpr (!HasSwapView<I>::value) {
-            std::swap(_iterator, _last);
+        if constexpr (!HasSwapView<Iterator>::value) {
+            std::swap(_iterator, _last.get());
         }
         else {
             _iterator.swapView();
         }
     }
 
-    constexpr View<FilterIterator<Char, Char, Func>, FilterIterator<Char, Char, Func>> toCommon() const {
-        using It = FilterIterator<Char, Char, Func>;
-        if constexpr (std::is_same_v<Char, Sentinel>) {
-            return view(It(_iterator, _last, _f.get()), It(_last, _last, _f.get()));
+    constexpr auto toCommon() const {
+        if constexpr (std::is_same_v<Iterator, Sentinel>) {
+            using It = FilterIterator<Iterator, Iterator, Func>;
+            return view(It(_iterator, _last.get(), _f.get()), It(_last.get(), _last.get(), _f.get()));
         }
         else {
+            using It = FilterIterator<CommonIter<Iterator>, CommonIter<Iterator>, Func>;
             auto v = _iterator.toCommon();
             auto begin = std::begin(v);
             auto end = std::end(v);
@@ -109,7 +186,7 @@ public:
 #    else
     template<class I = Iterator>
     EnableIf<!HasSwapView<I>::value> swapView() {
-        std::swap(_iterator, _last);
+        std::swap(_iterator, _last.get());
     }
 
     template<class I = Iterator>
@@ -117,23 +194,16 @@ public:
         _iterator.swapView();
     }
 
-    EMBIT_CONSTEXPR_CXX_20 reference back() const {
-        auto tmp(*this);
-        tmp.swapView();
-        return *--tmp;
-    }
-
     template<class I = Iterator>
     constexpr EnableIf<!HasToCommon<I>::value, View<FilterIterator<I, I, Func>, FilterIterator<I, I, Func>>>
     toCommon() const {
         using It = FilterIterator<I, I, Func>;
-        return view(It(_iterator, _last, _f.get()), It(_last, _last, _f.get()));
+        return view(It(_iterator, _last.get(), _f.get()), It(_last.get(), _last.get(), _f.get()));
     }
 
-    template<class I = Iterator>
-    constexpr EnableIf<HasToCommon<I>::value, View<FilterIterator<I, I, Func>, FilterIterator<I, I, Func>>>
-    toCommon() const {
-        using It = FilterIterator<I, I, Func>;
+    template<class I = Iterator, class C = CommonIter<I>>
+    constexpr EnableIf<HasToCommon<I>::value, View<FilterIterator<C, C, Func>, FilterIterator<C, C, Func>>> toCommon() const {
+        using It = FilterIterator<C, C, Func>;
         auto v = _iterator.toCommon();
         auto begin = std::begin(v);
         auto end = std::end(v);
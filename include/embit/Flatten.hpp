@@ -5,8 +5,10 @@
 #ifndef EMBIT_FLATTEN_HPP
 #define EMBIT_FLATTEN_HPP
 
-#include <iterator>
+#include <embit/Core.hpp>
 
+namespace embit {
+namespace detail {
 template<class, class U>
 struct AliasWrapper {
     using Type = U;
@@ -57,8 +59,8 @@ struct IterTraitsOrUnderlyingType {
 };
 
 template<class T>
-struct IterTraitsOrUnderlyingType<T, AliasWrapperT<typename T::iterator>> {
-    using Type = std::iterator_traits<typename T::iterator>;
+struct IterTraitsOrUnderlyingType<T, AliasWrapperT<decltype(std::begin(std::declval<T&>()))>> {
+    using Type = std::iterator_traits<decltype(std::begin(std::declval<T&>()))>;
 };
 
 template<class T, class U = void>
@@ -85,6 +87,37 @@ struct CountDimsHelper<false> {
 template<class T>
 using CountDims = typename CountDimsHelper<IsIterator<T>::value>::template type<T>;
 
+// The range that holds the actual elements, N levels below Range
+template<class Range, int N>
+struct InnermostRange {
+    using type = typename InnermostRange<decltype(*std::begin(std::declval<Range&>())), N - 1>::type;
+};
+
+template<class Range>
+struct InnermostRange<Range, 0> {
+    using type = Range;
+};
+
+template<int N>
+struct FlattenSize {
+    template<class Range>
+    static EMBIT_CONSTEXPR_CXX_14 std::size_t of(Range&& range) {
+        std::size_t size = 0;
+        for (auto&& inner : range) {
+            size += FlattenSize<N - 1>::of(inner);
+        }
+        return size;
+    }
+};
+
+template<>
+struct FlattenSize<0> {
+    template<class Range>
+    static constexpr std::size_t of(Range&& range) {
+        return static_cast<std::size_t>(embit::distance(range));
+    }
+};
+
 // Improvement of https://stackoverflow.com/a/21076724/8729023
 template<class Iterator>
 class FlattenWrapper {
@@ -135,7 +168,7 @@ public:
     }
 
     constexpr pointer operator->() const {
-        return &*this;
+        return &*_current;
     }
 
     constexpr FlattenWrapper& operator++() {
@@ -156,9 +189,14 @@ public:
 
     constexpr FlattenWrapper operator--(int) {
         FlattenWrapper tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
+
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return detail::forEachWhile(_current, _end, sink);
+    }
 };
 
 template<class Iterator, int N>
@@ -174,13 +212,17 @@ public:
     using difference_type = typename Inner::difference_type;
 
 private:
+    template<class Range>
+    static constexpr Inner innerBegin(Range&& range) {
+        return { std::begin(range), std::begin(range), std::end(range) };
+    }
+
     constexpr void advance() {
         if (_innerIter.hasSome()) {
             return;
         }
         for (++_outerIter; _outerIter.hasSome(); ++_outerIter) {
-            const auto begin = std::begin(*_outerIter);
-            _innerIter = { begin, begin, std::end(*_outerIter) };
+            _innerIter = innerBegin(*_outerIter);
             if (_innerIter.hasSome()) {
                 return;
             }
@@ -197,8 +239,7 @@ public:
     constexpr FlattenIterator(Iterator it, Iterator begin, Iterator end) :
         _outerIter(std::move(it), std::move(begin), std::move(end)) {
         if (_outerIter.hasSome()) {
-            const auto beg = std::begin(*_outerIter);
-            _innerIter = { beg, beg, std::end(*_outerIter) };
+            _innerIter = innerBegin(*_outerIter);
             this->advance();
         }
     }
@@ -224,7 +265,7 @@ public:
     }
 
     constexpr pointer operator->() const {
-        return &*this;
+        return &**this;
     }
 
     constexpr FlattenIterator& operator++() {
@@ -246,8 +287,9 @@ public:
         }
         while (_outerIter.hasPrev()) {
             --_outerIter;
-            const auto end = std::end(*_outerIter);
-            _innerIter = { end, std::begin(*_outerIter), end };
+            auto&& inner = *_outerIter;
+            const auto end = std::end(inner);
+            _innerIter = { end, std::begin(inner), end };
             if (_innerIter.hasPrev()) {
                 --_innerIter;
                 return *this;
@@ -261,6 +303,23 @@ public:
         --*this;
         return tmp;
     }
+
+    // Finishes the current inner range, then hands every following inner range to its own segment loop
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        if (!_outerIter.hasSome()) {
+            return true;
+        }
+        if (!_innerIter.forEachWhile(sink)) {
+            return false;
+        }
+        for (auto outer = std::next(_outerIter); outer.hasSome(); ++outer) {
+            if (!innerBegin(*outer).forEachWhile(sink)) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 template<class Iterator>
@@ -327,6 +386,60 @@ public:
         --*this;
         return tmp;
     }
+
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return _range.forEachWhile(sink);
+    }
 };
+} // namespace detail
+
+template<class Iterator, int N>
+class FlattenView : public View<detail::FlattenIterator<Iterator, N>, detail::FlattenIterator<Iterator, N>> {
+    using Base = View<detail::FlattenIterator<Iterator, N>, detail::FlattenIterator<Iterator, N>>;
+
+    Iterator _first{};
+    Iterator _last{};
+
+public:
+    using iterator = detail::FlattenIterator<Iterator, N>;
+    using const_iterator = iterator;
+
+    constexpr FlattenView(Iterator first, Iterator last) :
+        Base(iterator(first, first, last), iterator(last, first, last)),
+        _first(std::move(first)),
+        _last(std::move(last)) {
+    }
+
+    FlattenView() = default;
+
+    // Sums the sizes of the innermost ranges when they are sized, which is linear in the amount of inner ranges rather than
+    // in the amount of elements. There is deliberately no size(), as that would make adaptors and collect() treat the view
+    // as sized and pay for this pass up front
+    template<class R = View<Iterator, Iterator>>
+    constexpr auto distance() const
+        -> detail::EnableIf<detail::IsSizedView<typename detail::InnermostRange<R, N>::type>::value, IterDiffType<iterator>> {
+        return static_cast<IterDiffType<iterator>>(detail::FlattenSize<N>::of(embit::view(_first, _last)));
+    }
+
+    template<class R = View<Iterator, Iterator>>
+    constexpr auto distance() const
+        -> detail::EnableIf<!detail::IsSizedView<typename detail::InnermostRange<R, N>::type>::value, IterDiffType<iterator>> {
+        return detail::sizeOrCount(*this);
+    }
+
+    template<class Container, class... ContainerArgs>
+    constexpr Container collectAs(ContainerArgs&&... args) const {
+        return detail::collect<Container>(*this, std::forward<ContainerArgs>(args)...);
+    }
+};
+
+// Flattens every level of nesting that CountDims can detect, e.g. a std::vector<std::vector<int>> becomes a view of ints
+template<class V, class I = BeginIter<V>>
+constexpr FlattenView<I, detail::CountDims<std::iterator_traits<I>>::value - 1> flatten(V&& view) {
+    static_assert(std::is_same<I, EndIter<V>>::value, "flatten requires a view whose begin and end have the same type");
+    return { std::begin(view), std::end(view) };
+}
+} // namespace embit
 
 #endif // EMBIT_FLATTEN_HPP
@@ -5,12 +5,15 @@
 
 #    include "Core.hpp"
 
+#    include <memory>
+#    include <new>
+
 namespace embit {
 namespace detail {
 template<class>
 struct AlwaysFalse : std::false_type {};
 
-template<class Func>
+template<class Func, bool = std::is_trivially_copyable<Func>::value>
 class FunctionWrapper {
     mutable Func _func;
     bool _isConstructed{ false };
@@ -138,6 +141,100 @@ public:
         return _func(std::forward<Args>(args)...);
     }
 };
+
+template<class>
+struct IsConstMemberCall : std::false_type {};
+
+template<class R, class C, class... Args>
+struct IsConstMemberCall<R (C::*)(Args...) const> : std::true_type {};
+
+#    ifdef __cpp_noexcept_function_type
+template<class R, class C, class... Args>
+struct IsConstMemberCall<R (C::*)(Args...) const noexcept> : std::true_type {};
+#    endif // __cpp_noexcept_function_type
+
+// Function pointers and objects with a single const operator() (e.g. lambdas that are not mutable) are never modified by
+// a call
+template<class Func, class = int>
+struct IsConstCallable : std::is_pointer<Func> {};
+
+template<class Func>
+struct IsConstCallable<Func, decltype((void)&Func::operator(), 0)> : IsConstMemberCall<decltype(&Func::operator())> {};
+
+// Mutable members can't be read in constant expressions, so the callable is only mutable if calling it may modify it. The
+// constructors are user provided because GCC loses overlapping members when an empty aggregate is constant initialized
+template<class Func, bool = IsConstCallable<Func>::value>
+struct CallableStorage {
+    EMBIT_NO_UNIQUE_ADDRESS mutable Func func;
+
+    constexpr CallableStorage() : func() {
+    }
+
+    constexpr explicit CallableStorage(const Func& f) : func(f) {
+    }
+};
+
+template<class Func>
+struct CallableStorage<Func, true> {
+    EMBIT_NO_UNIQUE_ADDRESS Func func;
+
+    constexpr CallableStorage() : func() {
+    }
+
+    constexpr explicit CallableStorage(const Func& f) : func(f) {
+    }
+};
+
+// Trivially copyable callables (function pointers, captureless lambdas, lambdas capturing trivially copyable values) are
+// always constructed and can be recreated in place, so they need no construction flag. Empty ones take up no space at all
+template<class Func>
+class FunctionWrapper<Func, true> : CallableStorage<Func> {
+    using CallableStorage<Func>::func;
+
+    constexpr explicit FunctionWrapper(std::false_type /*isDefaultConstructible*/) {
+        static_assert(AlwaysFalse<Func>::value, "Please use std::function (if possible), an object with operator()() or a "
+                                                "regular function instead of a lambda in this case, because "
+                                                "lambda's are not default constructible pre C++20");
+    }
+
+    constexpr explicit FunctionWrapper(std::true_type /*isDefaultConstructible*/) : CallableStorage<Func>() {
+    }
+
+    template<class F = Func>
+    EMBIT_CONSTEXPR_CXX_14 EnableIf<std::is_copy_assignable<F>::value> assign(const Func& f) {
+        func = f;
+    }
+
+    // Lambdas are not copy assignable, but a trivially copyable object can be recreated without destroying it first
+    template<class F = Func>
+    EMBIT_CONSTEXPR_CXX_20 EnableIf<!std::is_copy_assignable<F>::value> assign(const Func& f) {
+        ::new (static_cast<void*>(std::addressof(func))) Func(f);
+    }
+
+public:
+    constexpr explicit FunctionWrapper(const Func& f) : CallableStorage<Func>(f) {
+    }
+
+    constexpr FunctionWrapper() : FunctionWrapper(std::is_default_constructible<Func>()) {
+    }
+
+    constexpr const Func& get() const noexcept {
+        return func;
+    }
+
+    FunctionWrapper(const FunctionWrapper&) = default;
+
+    EMBIT_CONSTEXPR_CXX_20 FunctionWrapper& operator=(const FunctionWrapper& other) {
+        assign(other.func);
+        return *this;
+    }
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const noexcept(noexcept(func(std::forward<Args>(args)...)))
+        -> decltype(func(std::forward<Args>(args)...)) {
+        return func(std::forward<Args>(args)...);
+    }
+};
 } // namespace detail
 } // namespace embit
 
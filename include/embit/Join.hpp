@@ -5,88 +5,176 @@
 #ifndef EMBIT_JOIN_HPP
 #define EMBIT_JOIN_HPP
 
+#include <embit/CString.hpp>
 #include <embit/Core.hpp>
 
 namespace embit {
 namespace detail {
 template<class Iterator, class Sentinel, class Char>
 class JoinIterator {
-    bool _useIterator{};
     Iterator _iterator{};
-    Sentinel _last{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, JoinIterator> _last{};
     const Char* _delimiter{ nullptr };
-    const Char* _delimiterIterator{ nullptr };
+    std::size_t _delimiterLength{};
+    std::size_t _delimiterIndex{};
+    bool _useIterator{};
 
 public:
+    using value_type = Char;
+    using reference = Char;
+    using pointer = const Char*;
+    using difference_type = IterDiffType<Iterator>;
+    using iterator_category = std::forward_iterator_tag;
+
     JoinIterator() = default;
 
-    JoinIterator(Iterator first, Sentinel last, const Char* delimiter) :
-        _useIterator(true),
+    JoinIterator(Iterator first, Sentinel last, const Char* delimiter, const std::size_t delimiterLength) :
         _iterator(std::move(first)),
         _last(std::move(last)),
         _delimiter(delimiter),
-        _delimiterIterator(_delimiter) {
+        _delimiterLength(delimiterLength),
+        _useIterator(true) {
     }
 
-    char operator*() const {
+    reference operator*() const {
         if (_useIterator) {
-            return *_iterator;
-        }
-        else {
-            return *_delimiterIterator;
+            return static_cast<Char>(*_iterator);
         }
+        return _delimiter[_delimiterIndex];
     }
 
     JoinIterator& operator++() {
         if (_useIterator) {
-            _useIterator = false;
             ++_iterator;
-            _delimiterIterator = _delimiter;
+            _useIterator = _delimiterLength == 0;
+            _delimiterIndex = 0;
         }
         else {
-            _delimiterIterator++;
-            _useIterator = *_delimiterIterator == '\0';
+            ++_delimiterIndex;
+            _useIterator = _delimiterIndex == _delimiterLength;
         }
         return *this;
     }
 
+    JoinIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    // The delimiter is only emitted between elements, so once the source is exhausted the join is done
+    friend bool operator==(const JoinIterator& lhs, DefaultSentinel) {
+        return lhs._iterator == lhs._last.get();
+    }
+
+    friend bool operator!=(const JoinIterator& lhs, DefaultSentinel s) {
+        return !(lhs == s);
+    }
+
+    friend bool operator==(const JoinIterator& lhs, const JoinIterator& rhs) {
+        return lhs._iterator == rhs._iterator && lhs._useIterator == rhs._useIterator &&
+               lhs._delimiterIndex == rhs._delimiterIndex;
+    }
+
     friend bool operator!=(const JoinIterator& lhs, const JoinIterator& rhs) {
-        return lhs._iterator != rhs._last;
+        return !(lhs == rhs);
     }
 
-    friend bool operator!=(const JoinIterator& lhs, const embit::DefaultSentinel) {
-        return lhs._iterator != lhs._last;
+    template<class OutputIterator>
+    OutputIterator copy(OutputIterator out) const {
+        auto first = _iterator;
+        if (!_useIterator) {
+            out = std::copy(_delimiter + _delimiterIndex, _delimiter + _delimiterLength, out);
+        }
+        if (first == _last.get()) {
+            return out;
+        }
+        *out++ = static_cast<Char>(*first);
+        for (++first; first != _last.get(); ++first) {
+            out = std::copy(_delimiter, _delimiter + _delimiterLength, out);
+            *out++ = static_cast<Char>(*first);
+        }
+        return out;
+    }
+
+    template<class Sink>
+    bool forEachWhile(Sink& sink) const {
+        auto first = _iterator;
+        if (!_useIterator) {
+            for (auto delimiter = _delimiter + _delimiterIndex; delimiter != _delimiter + _delimiterLength; ++delimiter) {
+                if (!sink(*delimiter)) {
+                    return false;
+                }
+            }
+        }
+        if (first == _last.get()) {
+            return true;
+        }
+        if (!sink(static_cast<Char>(*first))) {
+            return false;
+        }
+        for (++first; first != _last.get(); ++first) {
+            for (auto delimiter = _delimiter; delimiter != _delimiter + _delimiterLength; ++delimiter) {
+                if (!sink(*delimiter)) {
+                    return false;
+                }
+            }
+            if (!sink(static_cast<Char>(*first))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class I = Iterator>
+    EnableIf<IsRandomAccessIter<I>::value, std::size_t> size() const {
+        const auto elements = static_cast<std::size_t>(_last.get() - _iterator);
+        const auto pendingDelimiter = _useIterator ? 0 : _delimiterLength - _delimiterIndex;
+        if (elements == 0) {
+            return 0;
+        }
+        return elements + (elements - 1) * _delimiterLength + pendingDelimiter;
     }
 };
 } // namespace detail
 
 template<class Iterator, class Sentinel, class Char>
-class Join {
+class JoinView : public View<detail::JoinIterator<Iterator, Sentinel, Char>, DefaultSentinel> {
 public:
     using iterator = detail::JoinIterator<Iterator, Sentinel, Char>;
+    using const_iterator = iterator;
 
-private:
-    detail::JoinIterator<Iterator, Sentinel, Char> _iterator;
+    JoinView() = default;
 
-public:
-    using iterator = detail::JoinIterator<Iterator, Sentinel, Char>;
+    JoinView(Iterator i, Sentinel s, const Char* delimiter) :
+        View<iterator, DefaultSentinel>(iterator(std::move(i), std::move(s), delimiter, detail::strLength(delimiter)),
+                                        defaultSentinel) {
+    }
 
-    Join() = default;
+    // Total amount of characters written, so that the caller can allocate exactly once
+    template<class I = iterator>
+    auto size() const -> decltype(std::declval<I>().size()) {
+        return this->begin().size();
+    }
 
-    Join(Iterator i, Sentinel s, const Char* delimiter) : _iterator(std::move(i), std::move(s), delimiter) {
+    IterDiffType<iterator> distance() const {
+        return detail::sizeOrCount(*this);
     }
 
-    iterator begin() const {
-        return _iterator;
+    // Writes the elements element by element and the delimiters as whole blocks. Returns the end of the output
+    template<class OutputIterator>
+    OutputIterator copy(OutputIterator out) const {
+        return this->begin().copy(std::move(out));
     }
 
-    DefaultSentinel end() const {
-        return embit::defaultSentinel;
+    template<class Container, class... ContainerArgs>
+    Container collectAs(ContainerArgs&&... args) const {
+        return detail::collect<Container>(*this, std::forward<ContainerArgs>(args)...);
     }
 };
 
 template<class V, class Char>
-Join<embit::BeginIter<V>, embit::EndIter<V>, Char> join(V&& view, const Char* delimiter) {
+JoinView<embit::BeginIter<V>, embit::EndIter<V>, Char> join(V&& view, const Char* delimiter) {
     return { std::begin(view), std::end(view), delimiter };
 }
 } // namespace embit
@@ -7,18 +7,30 @@
 
 namespace embit {
 namespace detail {
+template<class Func, class Sink>
+struct MapSink {
+    Func& f;
+    Sink& sink;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        return sink(f(std::forward<T>(value)));
+    }
+};
+
 template<class Iterator, class Sentinel, class Func>
 class MapIterator {
     Iterator _iterator{};
-    Sentinel _last{};
-    mutable detail::FunctionWrapper<Func> _f{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, MapIterator> _last{};
+    EMBIT_NO_UNIQUE_ADDRESS detail::FunctionWrapper<Func> _f{};
 
     using Traits = std::iterator_traits<Iterator>;
 
 public:
     using reference = decltype(_f(*_iterator));
     using value_type = typename std::remove_reference<reference>::type;
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_category =
+        typename std::common_type<std::random_access_iterator_tag, typename Traits::iterator_category>::type;
     using difference_type = typename Traits::difference_type;
     using pointer = typename Traits::pointer;
 
@@ -56,8 +68,66 @@ public:
         return tmp;
     }
 
+    constexpr MapIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        return *this;
+    }
+
+    constexpr MapIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    constexpr MapIterator operator+(const difference_type offset) const {
+        auto tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    constexpr MapIterator operator-(const difference_type offset) const {
+        auto tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    constexpr reference operator[](const difference_type offset) const {
+        return _f(*(_iterator + offset));
+    }
+
+    constexpr friend MapIterator operator+(const difference_type offset, const MapIterator& a) {
+        return a + offset;
+    }
+
+    constexpr friend difference_type operator-(const MapIterator& a, const MapIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    constexpr friend difference_type operator-(DefaultSentinel, const MapIterator& a) {
+        return a._last.get() - a._iterator;
+    }
+
+    constexpr friend difference_type operator-(const MapIterator& a, DefaultSentinel s) {
+        return -(s - a);
+    }
+
+    constexpr friend bool operator<(const MapIterator& a, const MapIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    constexpr friend bool operator>(const MapIterator& a, const MapIterator& b) {
+        return b < a;
+    }
+
+    constexpr friend bool operator<=(const MapIterator& a, const MapIterator& b) {
+        return !(b < a);
+    }
+
+    constexpr friend bool operator>=(const MapIterator& a, const MapIterator& b) {
+        return !(a < b);
+    }
+
     constexpr friend bool operator==(const MapIterator& a, DefaultSentinel) noexcept {
-        return a._iterator == a._last;
+        return a._iterator == a._last.get();
     }
 
     constexpr friend bool operator!=(const MapIterator& a, DefaultSentinel s) noexcept {
@@ -72,10 +142,15 @@ public:
         return !(a == b);
     }
 
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return detail::forEachWhile(_iterator, _last.get(), MapSink<const FunctionWrapper<Func>, Sink>{ _f, sink });
+    }
+
 #    ifdef __cpp_if_constexpr
     EMBIT_CONSTEXPR_CXX_20 void swapView() {
         if constexpr (!HasSwapView<Iterator>::value) {
-            std::swap(_iterator, _last);
+            std::swap(_iterator, _last.get());
         }
         else {
             _iterator.swapView();
@@ -84,7 +159,7 @@ public:
 
     EMBIT_CONSTEXPR_CXX_17 reference back() const {
         if constexpr (std::is_same_v<Iterator, Sentinel>) {
-            return _f(*std::prev(_last));
+            return _f(*std::prev(_last.get()));
         }
         else {
             return _iterator.back();
@@ -92,11 +167,12 @@ public:
     }
 
     constexpr auto toCommon() const {
-        using It = MapIterator<Iterator, Iterator, Func>;
         if constexpr (std::is_same_v<Iterator, Sentinel>) {
-            return view(It(_iterator, _last, _f.get()), It(_last, _last, _f.get()));
+            using It = MapIterator<Iterator, Iterator, Func>;
+            return view(It(_iterator, _last.get(), _f.get()), It(_last.get(), _last.get(), _f.get()));
         }
         else {
+            using It = MapIterator<CommonIter<Iterator>, CommonIter<Iterator>, Func>;
             auto v = _iterator.toCommon();
             auto begin = std::begin(v);
             auto end = std::end(v);
@@ -106,7 +182,7 @@ public:
 #    else
     template<class I = Iterator>
     EnableIf<!HasSwapView<I>::value> swapView() {
-        std::swap(_iterator, _last);
+        std::swap(_iterator, _last.get());
     }
 
     template<class I = Iterator>
@@ -116,7 +192,7 @@ public:
 
     template<class I = Iterator>
     EMBIT_CONSTEXPR_CXX_17 EnableIf<!HasBack<I>::value, reference> back() const {
-        return _f(*std::prev(_last));
+        return _f(*std::prev(_last.get()));
     }
 
     template<class I = Iterator>
@@ -128,13 +204,12 @@ public:
     constexpr EnableIf<!HasToCommon<I>::value, View<MapIterator<I, I, Func>, MapIterator<I, I, Func>>>
     toCommon() const {
         using It = MapIterator<I, I, Func>;
-        return view(It(_iterator, _last, _f.get()), It(_last, _last, _f.get()));
+        return view(It(_iterator, _last.get(), _f.get()), It(_last.get(), _last.get(), _f.get()));
     }
 
-    template<class I = Iterator>
-    constexpr EnableIf<HasToCommon<I>::value, View<MapIterator<I, I, Func>, MapIterator<I, I, Func>>>
-    toCommon() const {
-        using It = MapIterator<I, I, Func>;
+    template<class I = Iterator, class C = CommonIter<I>>
+    constexpr EnableIf<HasToCommon<I>::value, View<MapIterator<C, C, Func>, MapIterator<C, C, Func>>> toCommon() const {
+        using It = MapIterator<C, C, Func>;
         auto v = _iterator.toCommon();
         auto begin = std::begin(v);
         auto end = std::end(v);
@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef EMBIT_MAPPED_FILE_HPP
+#    define EMBIT_MAPPED_FILE_HPP
+
+#    include "CString.hpp"
+
+#    ifdef EMBIT_HAS_POSIX
+#        include <cerrno>
+#        include <cstddef>
+#        include <fcntl.h>
+#        include <string>
+#        include <sys/mman.h>
+#        include <sys/stat.h>
+#        include <system_error>
+#        include <unistd.h>
+
+namespace embit {
+namespace detail {
+[[noreturn]] inline void throwMappingError(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+// Closes the descriptor once the file is mapped (or mapping failed), the mapping keeps its own reference to the file
+class FileDescriptor {
+    int _fd;
+
+public:
+    explicit FileDescriptor(const int fd) noexcept : _fd(fd) {
+    }
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    ~FileDescriptor() {
+        if (_fd >= 0) {
+            static_cast<void>(::close(_fd));
+        }
+    }
+
+    int get() const noexcept {
+        return _fd;
+    }
+};
+} // namespace detail
+
+// A read only memory mapping of a whole file, viewed as a string of its bytes. The bytes are bounded by the file size
+// rather than by a terminator, so files may contain '\0'. The mapping is unmapped on destruction, so like a container it
+// must outlive the views that are made from it
+class MappedFile : public CStringView<char, detail::CStringIterator<char>> {
+    using Base = CStringView<char, detail::CStringIterator<char>>;
+
+    void* _address{ nullptr };
+    std::size_t _length{};
+
+    // Empty files can't be mapped, they view an empty literal instead so that the iterators are never null
+    static Base emptyView() noexcept {
+        return embit::cstring("", static_cast<std::size_t>(0));
+    }
+
+    void unmap() noexcept {
+        if (_address) {
+            static_cast<void>(::munmap(_address, _length));
+            _address = nullptr;
+            _length = 0;
+        }
+    }
+
+public:
+    explicit MappedFile(const char* path) : Base(emptyView()) {
+        const detail::FileDescriptor fd(::open(path, O_RDONLY | O_CLOEXEC));
+        if (fd.get() < 0) {
+            detail::throwMappingError("embit: opening file for mapping failed");
+        }
+        struct ::stat status {};
+        if (::fstat(fd.get(), &status) != 0) {
+            detail::throwMappingError("embit: querying file size failed");
+        }
+        const auto length = static_cast<std::size_t>(status.st_size);
+        if (length == 0) {
+            return;
+        }
+        void* address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+        if (address == MAP_FAILED) {
+            detail::throwMappingError("embit: mapping file failed");
+        }
+        _address = address;
+        _length = length;
+        // Hints only: the pages are read front to back once, so read ahead aggressively and use huge pages if the kernel
+        // supports them for this mapping. Failures are not errors
+        static_cast<void>(::madvise(address, length, MADV_SEQUENTIAL));
+#        ifdef MADV_HUGEPAGE
+        static_cast<void>(::madvise(address, length, MADV_HUGEPAGE));
+#        endif // MADV_HUGEPAGE
+        const char* first = static_cast<const char*>(address);
+        Base::operator=(embit::cstring(first, first + length));
+    }
+
+    explicit MappedFile(const std::string& path) : MappedFile(path.c_str()) {
+    }
+
+    MappedFile(MappedFile&& other) noexcept : Base(other), _address(other._address), _length(other._length) {
+        other._address = nullptr;
+        other._length = 0;
+        static_cast<Base&>(other) = emptyView();
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            Base::operator=(other);
+            _address = other._address;
+            _length = other._length;
+            other._address = nullptr;
+            other._length = 0;
+            static_cast<Base&>(other) = emptyView();
+        }
+        return *this;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    const char* data() const noexcept {
+        return this->begin().get();
+    }
+};
+
+// Maps the file at `path` read only and views its bytes, so it can be adapted without copies or read() calls. Throws
+// std::system_error if the file can't be opened or mapped
+inline MappedFile mappedFile(const char* path) {
+    return MappedFile(path);
+}
+
+inline MappedFile mappedFile(const std::string& path) {
+    return MappedFile(path);
+}
+} // namespace embit
+
+#    endif // EMBIT_HAS_POSIX
+
+#endif // EMBIT_MAPPED_FILE_HPP
@@ -0,0 +1,233 @@
+#pragma once
+
+#ifndef EMBIT_PARALLEL_HPP
+#    define EMBIT_PARALLEL_HPP
+
+#    include "Core.hpp"
+
+#    include <condition_variable>
+#    include <deque>
+#    include <exception>
+#    include <functional>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+// Minimum amount of elements per chunk, smaller inputs are split into fewer chunks so that scheduling does not dominate
+#    ifndef EMBIT_PARALLEL_GRAIN_SIZE
+#        define EMBIT_PARALLEL_GRAIN_SIZE 4096
+#    endif // EMBIT_PARALLEL_GRAIN_SIZE
+
+namespace embit {
+class ThreadPool {
+    std::vector<std::thread> _workers;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _hasTask;
+    bool _stopping{ false };
+
+    void work() {
+        std::function<void()> task;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _hasTask.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                if (_tasks.empty()) {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+public:
+    explicit ThreadPool(const std::size_t threadCount) {
+        _workers.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            _workers.emplace_back([this] { work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _hasTask.notify_all();
+        for (std::thread& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t threadCount() const noexcept {
+        return _workers.size();
+    }
+
+    void push(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.push_back(std::move(task));
+        }
+        _hasTask.notify_one();
+    }
+
+    // Runs one queued task on the calling thread. Returns false if there was nothing to run
+    bool tryRunOne() {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_tasks.empty()) {
+                return false;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+        return true;
+    }
+};
+
+// One worker per hardware thread, minus the calling thread which always takes part in the work itself
+inline ThreadPool& defaultThreadPool() {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+namespace detail {
+class TaskGroup {
+    std::mutex _mutex;
+    std::condition_variable _finished;
+    std::size_t _pending;
+
+public:
+    explicit TaskGroup(const std::size_t pending) : _pending(pending) {
+    }
+
+    void finishOne() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_pending == 0) {
+            _finished.notify_all();
+        }
+    }
+
+    // Helps out with queued tasks while waiting, so that nested parallel calls from within a task cannot starve the pool
+    void wait(ThreadPool& pool) {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_pending == 0) {
+                    return;
+                }
+            }
+            if (!pool.tryRunOne()) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _finished.wait(lock, [this] { return _pending == 0; });
+                return;
+            }
+        }
+    }
+};
+
+// Wrapped so that concurrent writes to neighbouring partials never touch the same object (e.g. std::vector<bool>)
+template<class T>
+struct Partial {
+    T value;
+};
+
+inline std::size_t parallelChunkCount(const std::size_t size, const std::size_t requested) {
+    const std::size_t maxChunks = (size + EMBIT_PARALLEL_GRAIN_SIZE - 1) / EMBIT_PARALLEL_GRAIN_SIZE;
+    const std::size_t chunks = requested < maxChunks ? requested : maxChunks;
+    return chunks == 0 ? 1 : chunks;
+}
+} // namespace detail
+
+// Splits the view into `chunkCount` contiguous chunks, folds each chunk from `identity` with `fold` and combines the
+// partial results from left to right with `combine`. The partitioning only depends on the size and `chunkCount`, so the
+// result is deterministic for a fixed chunk count, even when `combine` is only associative up to rounding. Pass an
+// explicit chunk count to get the same partitioning on every machine. The calling thread folds the first chunk itself
+template<class V, class T, class FoldOp, class CombineOp>
+T parallelFoldl(V&& view, FoldOp fold, CombineOp combine, T identity, std::size_t chunkCount, ThreadPool& pool) {
+    static_assert(detail::IsRandomAccessView<V>::value, "View must be random access to be folded in parallel");
+    const auto first = std::begin(view);
+    const auto size = static_cast<std::size_t>(embit::distance(view));
+    chunkCount = detail::parallelChunkCount(size, chunkCount);
+
+    using Diff = IterDiffType<BeginIter<V>>;
+    const auto chunkBegin = [&](const std::size_t chunk) {
+        return first + static_cast<Diff>(size * chunk / chunkCount);
+    };
+
+    std::vector<detail::Partial<T>> partials(chunkCount, detail::Partial<T>{ identity });
+    std::vector<std::exception_ptr> errors(chunkCount);
+    detail::TaskGroup group(chunkCount - 1);
+
+    for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        pool.push([&, chunk] {
+            try {
+                FoldOp localFold = fold;
+                partials[chunk].value = embit::view(chunkBegin(chunk), chunkBegin(chunk + 1)).foldl(localFold, identity);
+            }
+            catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+            group.finishOne();
+        });
+    }
+
+    try {
+        partials[0].value = embit::view(first, chunkBegin(1)).foldl(fold, identity);
+    }
+    catch (...) {
+        errors[0] = std::current_exception();
+    }
+    group.wait(pool);
+
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    T result = std::move(partials[0].value);
+    for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        result = combine(std::move(result), std::move(partials[chunk].value));
+    }
+    return result;
+}
+
+template<class V, class T, class FoldOp, class CombineOp>
+T parallelFoldl(V&& view, FoldOp fold, CombineOp combine, T identity, const std::size_t chunkCount) {
+    return embit::parallelFoldl(view, std::move(fold), std::move(combine), std::move(identity), chunkCount,
+                                defaultThreadPool());
+}
+
+// Uses the default thread pool and one chunk per thread, including the calling thread
+template<class V, class T, class FoldOp, class CombineOp>
+T parallelFoldl(V&& view, FoldOp fold, CombineOp combine, T identity) {
+    return embit::parallelFoldl(view, std::move(fold), std::move(combine), std::move(identity),
+                                defaultThreadPool().threadCount() + 1, defaultThreadPool());
+}
+
+// Parallel fold where `combine` both folds the elements of a chunk and combines the partial results
+template<class V, class T, class CombineOp>
+T reduce(V&& view, CombineOp combine, T identity, const std::size_t chunkCount, ThreadPool& pool) {
+    return embit::parallelFoldl(view, combine, combine, std::move(identity), chunkCount, pool);
+}
+
+template<class V, class T, class CombineOp>
+T reduce(V&& view, CombineOp combine, T identity, const std::size_t chunkCount) {
+    return embit::parallelFoldl(view, combine, combine, std::move(identity), chunkCount);
+}
+
+template<class V, class T, class CombineOp>
+T reduce(V&& view, CombineOp combine, T identity) {
+    return embit::parallelFoldl(view, combine, combine, std::move(identity));
+}
+} // namespace embit
+
+#endif // EMBIT_PARALLEL_HPP
@@ -0,0 +1,361 @@
+#pragma once
+
+#ifndef EMBIT_PROBE_HPP
+#    define EMBIT_PROBE_HPP
+
+#    include "Map.hpp"
+
+#    include <cstdint>
+#    include <map>
+#    include <mutex>
+#    include <string>
+
+#    if defined(EMBIT_INSTRUMENT) && defined(EMBIT_INSTRUMENT_CYCLES)
+#        if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#            include <intrin.h>
+#            define EMBIT_HAS_RDTSC
+#        elif defined(__x86_64__) || defined(__i386__)
+#            include <x86intrin.h>
+#            define EMBIT_HAS_RDTSC
+#        else
+#            include <chrono>
+#        endif // x86
+#    endif // EMBIT_INSTRUMENT_CYCLES
+
+// Define EMBIT_INSTRUMENT to make probes count the elements that pass them, and additionally EMBIT_INSTRUMENT_CYCLES to
+// make them measure the time spent before them in the pipeline. Without EMBIT_INSTRUMENT, probe() returns the view it is
+// given and no code is generated for it. The macros must be set the same way for the whole program
+
+namespace embit {
+// What a probe measured. `elements` is the amount of elements that passed the probe, `cycles` (with
+// EMBIT_INSTRUMENT_CYCLES) the time that the stages before it spent producing them: TSC ticks on x86, steady_clock ticks
+// elsewhere. Counters are not atomic, a probe must only be iterated by one thread at a time
+struct ProbeStats {
+    std::uint64_t elements{};
+    std::uint64_t cycles{};
+};
+
+// The fraction of elements that made it from the probe `before` a stage to the probe `after` it, e.g. the pass ratio of
+// a filter. Returns 0 if nothing passed `before`
+inline double passRatio(const ProbeStats& before, const ProbeStats& after) noexcept {
+    return before.elements == 0 ? 0.0 : static_cast<double>(after.elements) / static_cast<double>(before.elements);
+}
+
+namespace detail {
+struct ProbeRegistry {
+    std::mutex mutex;
+    std::map<std::string, ProbeStats> stats;
+};
+
+inline ProbeRegistry& probeRegistry() {
+    static ProbeRegistry registry;
+    return registry;
+}
+
+template<class Func>
+struct TapFunc {
+    Func f;
+
+    // Lvalues are passed on as references, prvalues as values
+    template<class T>
+    T operator()(T&& value) const {
+        f(static_cast<const RemoveRef<T>&>(value));
+        return std::forward<T>(value);
+    }
+};
+} // namespace detail
+
+// The stats of the probe named `name`, created on first use. References stay valid for the lifetime of the program
+inline ProbeStats& probeStats(const std::string& name) {
+    auto& registry = detail::probeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.stats[name];
+}
+
+// Resets the stats of all named probes to 0
+inline void resetProbes() {
+    auto& registry = detail::probeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& entry : registry.stats) {
+        entry.second = ProbeStats();
+    }
+}
+
+// Calls `f` with a const reference to every element as it is produced and passes the element on unchanged
+template<class V, class Func>
+MapView<BeginIter<V>, EndIter<V>, detail::TapFunc<detail::Decay<Func>>> tap(V&& view, Func&& f) {
+    return { std::begin(view), std::end(view), detail::TapFunc<detail::Decay<Func>>{ std::forward<Func>(f) } };
+}
+
+#    ifdef EMBIT_INSTRUMENT
+namespace detail {
+#        ifdef EMBIT_INSTRUMENT_CYCLES
+inline std::uint64_t cycleCount() noexcept {
+#            ifdef EMBIT_HAS_RDTSC
+    return static_cast<std::uint64_t>(__rdtsc());
+#            else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#            endif // EMBIT_HAS_RDTSC
+}
+
+// Measures the time spent in its scope
+class CycleTimer {
+    std::uint64_t& _cycles;
+    std::uint64_t _start;
+
+public:
+    explicit CycleTimer(std::uint64_t& cycles) noexcept : _cycles(cycles), _start(cycleCount()) {
+    }
+
+    CycleTimer(const CycleTimer&) = delete;
+    CycleTimer& operator=(const CycleTimer&) = delete;
+
+    ~CycleTimer() {
+        _cycles += cycleCount() - _start;
+    }
+};
+#            define EMBIT_PROBE_TIME(CYCLES) const detail::CycleTimer embitProbeTimer(CYCLES)
+#        else
+#            define EMBIT_PROBE_TIME(CYCLES) static_cast<void>(0)
+#        endif // EMBIT_INSTRUMENT_CYCLES
+
+// Counts every element and takes the time spent downstream off the total, so that only the upstream cost remains
+template<class Sink>
+struct ProbeSink {
+    ProbeStats& stats;
+    Sink& sink;
+    std::uint64_t& downstreamCycles;
+
+    template<class T>
+    bool operator()(T&& value) const {
+        ++stats.elements;
+        EMBIT_PROBE_TIME(downstreamCycles);
+        return sink(std::forward<T>(value));
+    }
+};
+
+// Forwards everything to the underlying iterator. Elements are counted when the iterator moves past them (++, +=) or when
+// internal iteration pushes them, not when they are read, so that adaptors which read an element more than once (filter)
+// don't count it twice
+template<class Iterator, class Sentinel>
+class ProbeIterator {
+    Iterator _iterator{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, ProbeIterator> _last{};
+    ProbeStats* _stats{ nullptr };
+
+    using Traits = std::iterator_traits<Iterator>;
+
+public:
+    using reference = typename Traits::reference;
+    using value_type = typename Traits::value_type;
+    using iterator_category =
+        typename std::common_type<std::random_access_iterator_tag, typename Traits::iterator_category>::type;
+    using difference_type = typename Traits::difference_type;
+    using pointer = typename Traits::pointer;
+
+    ProbeIterator(Iterator current, Sentinel last, ProbeStats& stats) :
+        _iterator(std::move(current)),
+        _last(std::move(last)),
+        _stats(&stats) {
+    }
+
+    ProbeIterator() = default;
+
+    reference operator*() const {
+        EMBIT_PROBE_TIME(_stats->cycles);
+        return *_iterator;
+    }
+
+    ProbeIterator& operator++() {
+        ++_stats->elements;
+        EMBIT_PROBE_TIME(_stats->cycles);
+        ++_iterator;
+        return *this;
+    }
+
+    ProbeIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    ProbeIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    ProbeIterator operator--(int) {
+        auto tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    ProbeIterator& operator+=(const difference_type offset) {
+        if (offset > 0) {
+            _stats->elements += static_cast<std::uint64_t>(offset);
+        }
+        EMBIT_PROBE_TIME(_stats->cycles);
+        _iterator += offset;
+        return *this;
+    }
+
+    ProbeIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    // Copies at an offset are lookups (e.g. the end of a take), not progress, so they are not counted
+    ProbeIterator operator+(const difference_type offset) const {
+        auto tmp(*this);
+        tmp._iterator += offset;
+        return tmp;
+    }
+
+    ProbeIterator operator-(const difference_type offset) const {
+        auto tmp(*this);
+        tmp._iterator -= offset;
+        return tmp;
+    }
+
+    reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    friend ProbeIterator operator+(const difference_type offset, const ProbeIterator& a) {
+        return a + offset;
+    }
+
+    friend difference_type operator-(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    friend difference_type operator-(DefaultSentinel, const ProbeIterator& a) {
+        return a._last.get() - a._iterator;
+    }
+
+    friend difference_type operator-(const ProbeIterator& a, DefaultSentinel s) {
+        return -(s - a);
+    }
+
+    friend bool operator<(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    friend bool operator>(const ProbeIterator& a, const ProbeIterator& b) {
+        return b < a;
+    }
+
+    friend bool operator<=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(b < a);
+    }
+
+    friend bool operator>=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(a < b);
+    }
+
+    friend bool operator==(const ProbeIterator& a, DefaultSentinel) {
+        return a._iterator == a._last.get();
+    }
+
+    friend bool operator!=(const ProbeIterator& a, DefaultSentinel s) {
+        return !(a == s);
+    }
+
+    friend bool operator==(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    friend bool operator!=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(a == b);
+    }
+
+    template<class Sink>
+    bool forEachWhile(Sink& sink) const {
+        std::uint64_t total{};
+        std::uint64_t downstream{};
+        bool result;
+        {
+            EMBIT_PROBE_TIME(total);
+            result = detail::forEachWhile(_iterator, _last.get(), ProbeSink<Sink>{ *_stats, sink, downstream });
+        }
+        _stats->cycles += total - downstream;
+        return result;
+    }
+
+    template<class I = Iterator>
+    EnableIf<!HasSwapView<I>::value> swapView() {
+        std::swap(_iterator, _last.get());
+    }
+
+    template<class I = Iterator>
+    EnableIf<HasSwapView<I>::value> swapView() {
+        _iterator.swapView();
+    }
+
+    template<class I = Iterator>
+    EnableIf<!HasBack<I>::value, reference> back() const {
+        return *std::prev(_last.get());
+    }
+
+    template<class I = Iterator>
+    EnableIf<HasBack<I>::value, reference> back() const {
+        return _iterator.back();
+    }
+
+    template<class I = Iterator>
+    EnableIf<!HasToCommon<I>::value, View<ProbeIterator<I, I>, ProbeIterator<I, I>>> toCommon() const {
+        using It = ProbeIterator<I, I>;
+        return embit::view(It(_iterator, _last.get(), *_stats), It(_last.get(), _last.get(), *_stats));
+    }
+
+    template<class I = Iterator, class C = CommonIter<I>>
+    EnableIf<HasToCommon<I>::value, View<ProbeIterator<C, C>, ProbeIterator<C, C>>> toCommon() const {
+        using It = ProbeIterator<C, C>;
+        auto v = _iterator.toCommon();
+        auto begin = std::begin(v);
+        auto end = std::end(v);
+        return embit::view(It(std::move(begin), end, *_stats), It(end, end, *_stats));
+    }
+};
+
+#        undef EMBIT_PROBE_TIME
+} // namespace detail
+
+template<class Iterator, class Sentinel>
+class ProbeView : public View<detail::ProbeIterator<Iterator, Sentinel>, DefaultSentinel> {
+public:
+    using iterator = detail::ProbeIterator<Iterator, Sentinel>;
+    using const_iterator = iterator;
+
+    ProbeView(Iterator first, Sentinel last, ProbeStats& stats) :
+        View<iterator, DefaultSentinel>(iterator(std::move(first), std::move(last), stats), defaultSentinel) {
+    }
+
+    ProbeView() = default;
+};
+
+// Records the elements that pass this point of a pipeline into `stats`, which must outlive the view. Put probes before
+// and after a stage to see how many elements it lets through (passRatio) and what it costs
+template<class V>
+ProbeView<BeginIter<V>, EndIter<V>> probe(V&& view, ProbeStats& stats) {
+    return { std::begin(view), std::end(view), stats };
+}
+
+template<class V>
+ProbeView<BeginIter<V>, EndIter<V>> probe(V&& view, const char* name) {
+    return embit::probe(std::forward<V>(view), embit::probeStats(name));
+}
+#    else
+template<class V>
+constexpr View<BeginIter<V>, EndIter<V>> probe(V&& view, ProbeStats&) {
+    return embit::view(std::begin(view), std::end(view));
+}
+
+template<class V>
+constexpr View<BeginIter<V>, EndIter<V>> probe(V&& view, const char*) {
+    return embit::view(std::begin(view), std::end(view));
+}
+#    endif // EMBIT_INSTRUMENT
+} // namespace embit
+
+#endif // EMBIT_PROBE_HPP
@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef EMBIT_RANGE_HPP
+#    define EMBIT_RANGE_HPP
+
+#    include "Core.hpp"
+
+#    include <cstddef>
+#    include <limits>
+
+namespace embit {
+namespace detail {
+// Integral distances and offsets are computed in an unsigned type (of at least int's rank, so that it isn't promoted back to
+// int), where they wrap instead of overflowing
+template<class T>
+using RangeUnsigned = typename std::common_type<typename std::make_unsigned<T>::type, unsigned>::type;
+
+// `to` - `from`, which may not fit in T
+template<class T>
+constexpr RangeUnsigned<T> rangeDistance(const T from, const T to) noexcept {
+    return static_cast<RangeUnsigned<T>>(static_cast<RangeUnsigned<T>>(to) - static_cast<RangeUnsigned<T>>(from));
+}
+
+// Lengths that don't fit in std::ptrdiff_t (e.g. of a full range of long long) are clamped, like iota's
+template<class U>
+constexpr std::ptrdiff_t clampLength(const U length) noexcept {
+    return length > static_cast<typename std::make_unsigned<std::ptrdiff_t>::type>((std::numeric_limits<std::ptrdiff_t>::max)())
+               ? (std::numeric_limits<std::ptrdiff_t>::max)()
+               : static_cast<std::ptrdiff_t>(length);
+}
+
+template<class T>
+constexpr std::ptrdiff_t rangeLength(const T first, const T last, const T step, std::true_type /* isIntegral */) {
+    return step > 0 ? (last > first ? clampLength((rangeDistance(first, last) - 1) / rangeDistance(T(0), step) + 1) : 0)
+                    : (step < 0 && last < first ? clampLength((rangeDistance(last, first) - 1) / rangeDistance(step, T(0)) + 1)
+                                                : 0);
+}
+
+// Rounds up, without std::ceil (which is not constexpr). Infinite lengths are empty, too long ones are clamped
+template<class T>
+EMBIT_CONSTEXPR_CXX_14 std::ptrdiff_t rangeLength(const T first, const T last, const T step, std::false_type /* isIntegral */) {
+    if (step == 0) {
+        return 0;
+    }
+    const T steps = (last - first) / step;
+    if (!(steps > 0) || steps - steps != 0) {
+        return 0;
+    }
+    if (steps >= static_cast<T>((std::numeric_limits<std::ptrdiff_t>::max)())) {
+        return (std::numeric_limits<std::ptrdiff_t>::max)();
+    }
+    const auto length = static_cast<std::ptrdiff_t>(steps);
+    return static_cast<T>(length) < steps ? length + 1 : length;
+}
+
+// Values are computed from the index (first + index * step), so floating point ranges don't drift and every operation,
+// including distance and back, is O(1)
+template<class T>
+class RangeIterator : public IndexIterator<RangeIterator<T>, T, std::ptrdiff_t> {
+    static_assert(std::is_arithmetic<T>::value, "Ranges can only be made of arithmetic types");
+
+    using Base = IndexIterator<RangeIterator<T>, T, std::ptrdiff_t>;
+
+public:
+    using value_type = T;
+    using pointer = void;
+    using typename Base::difference_type;
+
+private:
+    T _first{};
+    T _step{};
+
+    static constexpr T
+    valueAt(const T first, const T step, const difference_type index, std::true_type /* isIntegral */) noexcept {
+        return static_cast<T>(static_cast<RangeUnsigned<T>>(first) +
+                              static_cast<RangeUnsigned<T>>(index) * static_cast<RangeUnsigned<T>>(step));
+    }
+
+    static constexpr T
+    valueAt(const T first, const T step, const difference_type index, std::false_type /* isIntegral */) noexcept {
+        return static_cast<T>(first + static_cast<T>(index) * step);
+    }
+
+    // Integers are exact, so they can be accumulated, which keeps the loop a plain counted one. The value after the last
+    // one may not fit in T, so the last value is pushed outside of the loop
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhileImpl(Sink& sink, std::true_type /* isIntegral */) const {
+        difference_type remaining = this->_end - this->_index;
+        if (remaining <= 0) {
+            return true;
+        }
+        T value = at(this->_index);
+        for (; remaining > 1; --remaining) {
+            if (!sink(static_cast<T>(value))) {
+                return false;
+            }
+            value = static_cast<T>(value + _step);
+        }
+        return sink(static_cast<T>(value));
+    }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhileImpl(Sink& sink, std::false_type /* isIntegral */) const {
+        return Base::forEachWhile(sink);
+    }
+
+public:
+    constexpr RangeIterator(const T first, const T step, const difference_type index, const difference_type end) noexcept :
+        Base(index, end),
+        _first(first),
+        _step(step) {
+    }
+
+    RangeIterator() = default;
+
+    constexpr T at(const difference_type index) const noexcept {
+        return valueAt(_first, _step, index, std::is_integral<T>());
+    }
+
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        return forEachWhileImpl(sink, std::is_integral<T>());
+    }
+};
+} // namespace detail
+
+template<class T>
+class RangeView : public View<detail::RangeIterator<T>, DefaultSentinel> {
+public:
+    using iterator = detail::RangeIterator<T>;
+    using const_iterator = iterator;
+
+    constexpr RangeView(const T first, const T step, const std::ptrdiff_t length) noexcept :
+        View<iterator, DefaultSentinel>(iterator(first, step, 0, length), defaultSentinel) {
+    }
+
+    RangeView() = default;
+
+    constexpr std::ptrdiff_t size() const noexcept {
+        return this->begin().size();
+    }
+};
+
+// [first, last) in steps of `step`, which may be negative. A step of 0 yields an empty range
+template<class T>
+constexpr RangeView<T> range(const T first, const T last, const T step) noexcept {
+    return { first, step, detail::rangeLength(first, last, step, std::is_integral<T>()) };
+}
+
+template<class T>
+constexpr RangeView<T> range(const T first, const T last) noexcept {
+    return embit::range(first, last, static_cast<T>(1));
+}
+
+// [0, last)
+template<class T>
+constexpr RangeView<T> range(const T last) noexcept {
+    return embit::range(static_cast<T>(0), last, static_cast<T>(1));
+}
+
+// Unbounded sequence first, first + step, ... It still reports a (maximal) size, so that adaptors such as take keep it
+// random access
+template<class T>
+constexpr RangeView<T> iota(const T first, const T step = static_cast<T>(1)) noexcept {
+    return { first, step, (std::numeric_limits<std::ptrdiff_t>::max)() };
+}
+} // namespace embit
+
+#endif // EMBIT_RANGE_HPP
@@ -0,0 +1,187 @@
+#pragma once
+
+#ifndef EMBIT_SPLIT_HPP
+#    define EMBIT_SPLIT_HPP
+
+#    include "CString.hpp"
+#    include "Chunk.hpp"
+
+#    include <memory>
+#    include <string>
+#    include <utility>
+
+namespace embit {
+namespace detail {
+template<class Char>
+using CharRange = std::pair<const Char*, const Char*>;
+
+template<class Char, class S>
+EMBIT_CONSTEXPR_CXX_20 CharRange<Char> charRange(const CStringIterator<Char> first, const S last) noexcept {
+    return { first.get(), cstringEnd(first.get(), last) };
+}
+
+template<class Iterator, class S,
+         class Char = typename std::remove_const<typename std::iterator_traits<Iterator>::value_type>::type>
+EnableIf<IsContiguousIter<Iterator>::value, CharRange<Char>> charRange(const Iterator first, const S last) {
+    if (first == last) {
+        return { nullptr, nullptr };
+    }
+    const Char* data = std::addressof(*first);
+    return { data, data + (last - first) };
+}
+
+// Returns the start of the first occurrence of the delimiter `delimiterFirst` + `delimiterRest` (of `delimiterLength`
+// characters in total) in [first, last), or `last`. The first character is located with char_traits::find (memchr for
+// char), and only its occurrences are compared in full
+template<class Char>
+const Char* findDelimiter(const Char* first, const Char* last, const Char delimiterFirst, const Char* delimiterRest,
+                          const std::size_t delimiterLength) noexcept {
+    using Traits = std::char_traits<Char>;
+    while (static_cast<std::size_t>(last - first) >= delimiterLength) {
+        const std::size_t candidates = static_cast<std::size_t>(last - first) - delimiterLength + 1;
+        const Char* found = Traits::find(first, candidates, delimiterFirst);
+        if (!found) {
+            return last;
+        }
+        if (delimiterLength == 1 || Traits::compare(found + 1, delimiterRest, delimiterLength - 1) == 0) {
+            return found;
+        }
+        first = found + 1;
+    }
+    return last;
+}
+
+// Each increment is one scan up to the next delimiter, tokens are pointer ranges into the source
+template<class Char>
+class SplitIterator {
+    const Char* _tokenFirst{ nullptr };
+    const Char* _tokenLast{ nullptr };
+    const Char* _last{ nullptr };
+    const Char* _delimiterRest{ nullptr };
+    std::size_t _delimiterLength{};
+    Char _delimiterFirst{};
+    bool _done{ true };
+
+    const Char* findNext(const Char* first) const noexcept {
+        if (_delimiterLength == 0) {
+            return _last;
+        }
+        return findDelimiter(first, _last, _delimiterFirst, _delimiterRest, _delimiterLength);
+    }
+
+public:
+    using value_type = CStringView<Char, CStringIterator<Char>>;
+    using reference = value_type;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    SplitIterator(const CharRange<Char> range, const Char delimiterFirst, const Char* delimiterRest,
+                  const std::size_t delimiterLength) noexcept :
+        _tokenFirst(range.first),
+        _last(range.second),
+        _delimiterRest(delimiterRest),
+        _delimiterLength(delimiterLength),
+        _delimiterFirst(delimiterFirst),
+        _done(range.first == range.second) {
+        if (!_done) {
+            _tokenLast = findNext(_tokenFirst);
+        }
+    }
+
+    SplitIterator() = default;
+
+    reference operator*() const noexcept {
+        return embit::cstring(_tokenFirst, _tokenLast);
+    }
+
+    SplitIterator& operator++() noexcept {
+        if (_tokenLast == _last) {
+            _done = true;
+        }
+        else {
+            _tokenFirst = _tokenLast + _delimiterLength;
+            _tokenLast = findNext(_tokenFirst);
+        }
+        return *this;
+    }
+
+    SplitIterator operator++(int) noexcept {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const SplitIterator& a, DefaultSentinel) noexcept {
+        return a._done;
+    }
+
+    friend bool operator!=(const SplitIterator& a, DefaultSentinel s) noexcept {
+        return !(a == s);
+    }
+
+    friend bool operator==(const SplitIterator& a, const SplitIterator& b) noexcept {
+        return a._done == b._done && (a._done || a._tokenFirst == b._tokenFirst);
+    }
+
+    friend bool operator!=(const SplitIterator& a, const SplitIterator& b) noexcept {
+        return !(a == b);
+    }
+
+    template<class Sink>
+    bool forEachWhile(Sink& sink) const {
+        if (_done) {
+            return true;
+        }
+        const Char* first = _tokenFirst;
+        const Char* last = _tokenLast;
+        while (true) {
+            if (!sink(embit::cstring(first, last))) {
+                return false;
+            }
+            if (last == _last) {
+                return true;
+            }
+            first = last + _delimiterLength;
+            last = findNext(first);
+        }
+    }
+
+    // A default constructed iterator is always at the end
+    View<SplitIterator, SplitIterator> toCommon() const noexcept {
+        return embit::view(*this, SplitIterator());
+    }
+};
+} // namespace detail
+
+template<class Char>
+class SplitView : public View<detail::SplitIterator<Char>, DefaultSentinel> {
+public:
+    using iterator = detail::SplitIterator<Char>;
+    using const_iterator = iterator;
+
+    SplitView(const detail::CharRange<Char> range, const Char delimiterFirst, const Char* delimiterRest,
+              const std::size_t delimiterLength) noexcept :
+        View<iterator, DefaultSentinel>(iterator(range, delimiterFirst, delimiterRest, delimiterLength), defaultSentinel) {
+    }
+
+    SplitView() = default;
+};
+
+// Splits a view of characters at every occurrence of `delimiter` into CStringViews that point into the source, without
+// copying. The view must be a cstring or have contiguous iterators (pointers, std::string, std::vector, ...). n delimiters
+// yield n + 1 tokens, empty ones included ("a,,b," -> "a", "", "b", ""), and an empty view yields none
+template<class V, class Char>
+SplitView<Char> split(V&& view, const Char delimiter) {
+    return { detail::charRange(std::begin(view), std::end(view)), delimiter, nullptr, 1 };
+}
+
+// Multi character delimiter, which must outlive the split. An empty delimiter yields the whole view as one token
+template<class V, class Char>
+SplitView<Char> split(V&& view, const Char* delimiter) {
+    const std::size_t length = detail::strLength(delimiter);
+    return { detail::charRange(std::begin(view), std::end(view)), length == 0 ? Char() : delimiter[0], delimiter + 1, length };
+}
+} // namespace embit
+
+#endif // EMBIT_SPLIT_HPP
@@ -0,0 +1,151 @@
+#pragma once
+
+#ifndef EMBIT_STATIC_VECTOR_HPP
+#    define EMBIT_STATIC_VECTOR_HPP
+
+#    include "Core.hpp"
+
+#    include <cstddef>
+#    include <initializer_list>
+
+namespace embit {
+// Vector with inline storage for at most N elements, that never allocates. push_back on a full vector does nothing and
+// returns false, so collecting a view into it truncates. T must be default constructible, which keeps it usable in
+// constant expressions
+template<class T, std::size_t N>
+class StaticVector {
+    T _data[N == 0 ? 1 : N]{};
+    std::size_t _size{};
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr StaticVector() = default;
+
+    EMBIT_CONSTEXPR_CXX_14 StaticVector(std::initializer_list<T> values) {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    constexpr size_type size() const noexcept {
+        return _size;
+    }
+
+    constexpr bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    constexpr bool full() const noexcept {
+        return _size == N;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 bool push_back(const T& value) {
+        if (full()) {
+            return false;
+        }
+        _data[_size++] = value;
+        return true;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 bool push_back(T&& value) {
+        if (full()) {
+            return false;
+        }
+        _data[_size++] = std::move(value);
+        return true;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 void pop_back() noexcept {
+        _data[--_size] = T();
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 void clear() noexcept {
+        while (!empty()) {
+            pop_back();
+        }
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 reference operator[](const size_type index) noexcept {
+        return _data[index];
+    }
+
+    constexpr const_reference operator[](const size_type index) const noexcept {
+        return _data[index];
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 reference front() noexcept {
+        return _data[0];
+    }
+
+    constexpr const_reference front() const noexcept {
+        return _data[0];
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 reference back() noexcept {
+        return _data[_size - 1];
+    }
+
+    constexpr const_reference back() const noexcept {
+        return _data[_size - 1];
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 pointer data() noexcept {
+        return _data;
+    }
+
+    constexpr const_pointer data() const noexcept {
+        return _data;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 iterator begin() noexcept {
+        return _data;
+    }
+
+    constexpr const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 iterator end() noexcept {
+        return _data + _size;
+    }
+
+    constexpr const_iterator end() const noexcept {
+        return _data + _size;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator==(const StaticVector& a, const StaticVector& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_type i = 0; i < a.size(); ++i) {
+            if (!(a[i] == b[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 friend bool operator!=(const StaticVector& a, const StaticVector& b) {
+        return !(a == b);
+    }
+};
+} // namespace embit
+
+#endif // EMBIT_STATIC_VECTOR_HPP
@@ -0,0 +1,224 @@
+#pragma once
+
+#ifndef EMBIT_STREAM_HPP
+#    define EMBIT_STREAM_HPP
+
+#    include "Core.hpp"
+
+#    include <cstddef>
+#    include <istream>
+#    include <memory>
+
+#    ifdef EMBIT_HAS_POSIX
+#        include <cerrno>
+#        include <fcntl.h>
+#        include <system_error>
+#        include <unistd.h>
+#    endif // EMBIT_HAS_POSIX
+
+// Size of the buffer that stream sources allocate when the caller does not provide one
+#    ifndef EMBIT_STREAM_BUFFER_SIZE
+#        define EMBIT_STREAM_BUFFER_SIZE (64 * 1024)
+#    endif // EMBIT_STREAM_BUFFER_SIZE
+
+namespace embit {
+namespace detail {
+#    ifdef EMBIT_HAS_POSIX
+class FdReader {
+    int _fd;
+
+public:
+    explicit FdReader(const int fd) noexcept : _fd(fd) {
+#        ifdef POSIX_FADV_SEQUENTIAL
+        // Only a hint to read ahead more aggressively, so failure (e.g. for pipes) is not an error
+        static_cast<void>(::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL));
+#        endif // POSIX_FADV_SEQUENTIAL
+    }
+
+    // Returns 0 at the end of the file, throws std::system_error if reading fails
+    std::size_t operator()(char* buffer, const std::size_t size) const {
+        while (true) {
+            const ::ssize_t count = ::read(_fd, buffer, size);
+            if (count >= 0) {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "embit: reading from file descriptor failed");
+            }
+        }
+    }
+};
+#    endif // EMBIT_HAS_POSIX
+
+class StreamReader {
+    std::istream* _stream;
+
+public:
+    explicit StreamReader(std::istream& stream) noexcept : _stream(&stream) {
+    }
+
+    // Returns 0 at the end of the stream. Errors are reported the way the stream is configured to (see exceptions())
+    std::size_t operator()(char* buffer, const std::size_t size) const {
+        _stream->read(buffer, static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(_stream->gcount());
+    }
+};
+
+template<class Reader>
+struct StreamState {
+    Reader reader;
+    std::unique_ptr<char[]> ownedBuffer;
+    char* buffer;
+    std::size_t capacity;
+    std::size_t position{};
+    std::size_t filled{};
+
+    StreamState(Reader r, char* buf, const std::size_t cap) : reader(std::move(r)), buffer(buf), capacity(cap) {
+    }
+
+    StreamState(Reader r, const std::size_t cap) :
+        reader(std::move(r)),
+        ownedBuffer(new char[cap]),
+        buffer(ownedBuffer.get()),
+        capacity(cap) {
+    }
+
+    // Returns false if the source is exhausted
+    bool refill() {
+        position = 0;
+        filled = reader(buffer, capacity);
+        return filled != 0;
+    }
+
+    bool atEnd() {
+        return position == filled && !refill();
+    }
+};
+
+// Single pass: all copies share the same buffer and read position, advancing one advances all of them
+template<class Reader>
+class StreamIterator {
+    using State = StreamState<Reader>;
+
+    std::shared_ptr<State> _state;
+
+    bool atEnd() const {
+        return !_state || _state->atEnd();
+    }
+
+public:
+    using value_type = char;
+    using reference = char;
+    using pointer = const char*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    explicit StreamIterator(std::shared_ptr<State> state) noexcept : _state(std::move(state)) {
+    }
+
+    StreamIterator() = default;
+
+    reference operator*() const {
+        return _state->buffer[_state->position];
+    }
+
+    StreamIterator& operator++() {
+        ++_state->position;
+        return *this;
+    }
+
+    StreamIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const StreamIterator& a, DefaultSentinel) {
+        return a.atEnd();
+    }
+
+    friend bool operator!=(const StreamIterator& a, DefaultSentinel s) {
+        return !(a == s);
+    }
+
+    friend bool operator==(const StreamIterator& a, const StreamIterator& b) {
+        return a.atEnd() == b.atEnd();
+    }
+
+    friend bool operator!=(const StreamIterator& a, const StreamIterator& b) {
+        return !(a == b);
+    }
+
+    // One tight loop per buffer fill. Elements pushed into the sink are consumed, including the one it stops at
+    template<class Sink>
+    bool forEachWhile(Sink& sink) const {
+        if (!_state) {
+            return true;
+        }
+        State& state = *_state;
+        do {
+            const char* const first = state.buffer;
+            const char* const last = first + state.filled;
+            for (const char* it = first + state.position; it != last; ++it) {
+                if (!sink(*it)) {
+                    state.position = static_cast<std::size_t>(it - first) + 1;
+                    return false;
+                }
+            }
+            state.position = state.filled;
+        } while (state.refill());
+        return true;
+    }
+
+    // A default constructed iterator is always at the end
+    View<StreamIterator, StreamIterator> toCommon() const {
+        return embit::view(*this, StreamIterator());
+    }
+};
+} // namespace detail
+
+template<class Reader>
+class StreamView : public View<detail::StreamIterator<Reader>, DefaultSentinel> {
+    using State = detail::StreamState<Reader>;
+
+public:
+    using iterator = detail::StreamIterator<Reader>;
+    using const_iterator = iterator;
+
+    StreamView(Reader reader, char* buffer, const std::size_t bufferSize) :
+        View<iterator, DefaultSentinel>(iterator(std::make_shared<State>(std::move(reader), buffer, bufferSize)),
+                                        defaultSentinel) {
+    }
+
+    StreamView(Reader reader, const std::size_t bufferSize) :
+        View<iterator, DefaultSentinel>(iterator(std::make_shared<State>(std::move(reader), bufferSize)), defaultSentinel) {
+    }
+
+    StreamView() = default;
+};
+
+#    ifdef EMBIT_HAS_POSIX
+// Reads the bytes of `fd` through a buffer of `bufferSize` bytes, so memory use is constant regardless of the file size.
+// The view does not own the file descriptor
+inline StreamView<detail::FdReader> readFd(const int fd, const std::size_t bufferSize = EMBIT_STREAM_BUFFER_SIZE) {
+    return { detail::FdReader(fd), bufferSize };
+}
+
+// Reads through caller provided storage, which must outlive the view, instead of allocating a buffer
+inline StreamView<detail::FdReader> readFd(const int fd, char* buffer, const std::size_t bufferSize) {
+    return { detail::FdReader(fd), buffer, bufferSize };
+}
+#    endif // EMBIT_HAS_POSIX
+
+// Reads the characters of `stream` in blocks of `bufferSize`, unformatted (whitespace is not skipped)
+inline StreamView<detail::StreamReader> readStream(std::istream& stream,
+                                                  const std::size_t bufferSize = EMBIT_STREAM_BUFFER_SIZE) {
+    return { detail::StreamReader(stream), bufferSize };
+}
+
+inline StreamView<detail::StreamReader> readStream(std::istream& stream, char* buffer, const std::size_t bufferSize) {
+    return { detail::StreamReader(stream), buffer, bufferSize };
+}
+} // namespace embit
+
+#endif // EMBIT_STREAM_HPP
@@ -7,23 +7,208 @@
 
 namespace embit {
 namespace detail {
+template<class Sink, class DiffType>
+struct TakeSink {
+    Sink& sink;
+    DiffType& remaining;
+    bool& stopped;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        if (!sink(std::forward<T>(value))) {
+            stopped = true;
+            return false;
+        }
+        return --remaining > 0;
+    }
+};
+
+template<class Iterator, class Sentinel, bool = IsRandomAccessIter<Iterator>::value>
+class TakeIterator;
+
+// Random access: only the amount of remaining elements is stored next to the iterator, so nesting takes (or slices) grows
+// the iterator by one integer per level instead of by a whole copy of the underlying iterator
+template<class Iterator, class Sentinel>
+class TakeIterator<Iterator, Sentinel, true> {
+    using Traits = std::iterator_traits<Iterator>;
+
+public:
+    using reference = typename Traits::reference;
+    using value_type = typename Traits::value_type;
+    using iterator_category =
+        typename std::common_type<std::random_access_iterator_tag, typename Traits::iterator_category>::type;
+    using difference_type = typename Traits::difference_type;
+    using pointer = typename Traits::pointer;
+
+private:
+    Iterator _iterator{};
+    difference_type _remaining{};
+
+    constexpr TakeIterator(Iterator iterator, const difference_type remaining, std::true_type /*isExact*/) :
+        _iterator(std::move(iterator)),
+        _remaining(remaining) {
+    }
+
+public:
+    constexpr TakeIterator(Iterator iterator, Sentinel last, const difference_type amount) :
+        _iterator(iterator),
+        _remaining(amount < 0 ? 0 : (amount < last - iterator ? amount : last - iterator)) {
+    }
+
+    TakeIterator() = default;
+
+    constexpr reference operator*() const {
+        return *_iterator;
+    }
+
+    constexpr TakeIterator& operator++() {
+        ++_iterator;
+        --_remaining;
+        return *this;
+    }
+
+    constexpr TakeIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    constexpr TakeIterator& operator--() {
+        --_iterator;
+        ++_remaining;
+        return *this;
+    }
+
+    constexpr TakeIterator operator--(int) {
+        auto tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    constexpr TakeIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        _remaining -= offset;
+        return *this;
+    }
+
+    constexpr TakeIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        _remaining += offset;
+        return *this;
+    }
+
+    constexpr TakeIterator operator+(const difference_type offset) const {
+        auto tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    constexpr TakeIterator operator-(const difference_type offset) const {
+        auto tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    constexpr reference operator[](const difference_type offset) const {
+        return *(_iterator + offset);
+    }
+
+    constexpr friend TakeIterator operator+(const difference_type offset, const TakeIterator& a) {
+        return a + offset;
+    }
+
+    constexpr friend difference_type operator-(const TakeIterator& a, const TakeIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    constexpr friend difference_type operator-(DefaultSentinel, const TakeIterator& a) {
+        return a._remaining;
+    }
+
+    constexpr friend difference_type operator-(const TakeIterator& a, DefaultSentinel s) {
+        return -(s - a);
+    }
+
+    constexpr friend bool operator<(const TakeIterator& a, const TakeIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    constexpr friend bool operator>(const TakeIterator& a, const TakeIterator& b) {
+        return b < a;
+    }
+
+    constexpr friend bool operator<=(const TakeIterator& a, const TakeIterator& b) {
+        return !(b < a);
+    }
+
+    constexpr friend bool operator>=(const TakeIterator& a, const TakeIterator& b) {
+        return !(a < b);
+    }
+
+    constexpr friend bool operator==(const TakeIterator& a, DefaultSentinel) noexcept {
+        return a._remaining == 0;
+    }
+
+    constexpr friend bool operator!=(const TakeIterator& a, DefaultSentinel s) noexcept {
+        return !(a == s);
+    }
+
+    constexpr friend bool operator==(const TakeIterator& a, const TakeIterator& b) noexcept {
+        return a._iterator == b._iterator;
+    }
+
+    constexpr friend bool operator!=(const TakeIterator& a, const TakeIterator& b) noexcept {
+        return !(a == b);
+    }
+
+    template<class Sink>
+    constexpr bool forEachWhile(Sink& sink) const {
+        return detail::forEachWhile(_iterator, _iterator + _remaining, sink);
+    }
+
+    // The remaining count turns negative and grows back to 0 as the reversed view walks from the end to the beginning
+    EMBIT_CONSTEXPR_CXX_14 void swapView() noexcept {
+        _iterator += _remaining;
+        _remaining = -_remaining;
+    }
+
+    constexpr reference back() const {
+        return *(_iterator + (_remaining - 1));
+    }
+
+    constexpr difference_type size() const {
+        return _remaining;
+    }
+
+    constexpr View<TakeIterator, TakeIterator> toCommon() const {
+        return embit::view(TakeIterator(_iterator, _remaining, std::true_type()),
+                           TakeIterator(_iterator + _remaining, 0, std::true_type()));
+    }
+};
+
+// Forward (or weaker): count down the remaining amount and stop early when the source runs out
 template<class Iterator, class Sentinel>
-class TakeIterator {
+class TakeIterator<Iterator, Sentinel, false> {
     Iterator _iterator{};
-    Sentinel _last{};
-    std::size_t _amount{};
-    std::size_t _current{};
+    EMBIT_NO_UNIQUE_ADDRESS SentinelStorage<Sentinel, TakeIterator> _last{};
 
     using Traits = std::iterator_traits<Iterator>;
 
 public:
     using reference = typename Traits::reference;
     using value_type = typename Traits::value_type;
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename Traits::iterator_category>::type;
     using difference_type = typename Traits::difference_type;
     using pointer = typename Traits::pointer;
 
-    TakeIterator(Iterator iterator, Sentinel end, const std::size_t amount) : _iterator(iterator), _amount(amount) {
+private:
+    difference_type _amount{};
+
+public:
+    constexpr TakeIterator(Iterator iterator, Sentinel last, const difference_type amount) :
+        _iterator(std::move(iterator)),
+        _last(std::move(last)),
+        _amount(amount) {
     }
 
     TakeIterator() = default;
@@ -33,7 +218,7 @@ public:
     }
 
     constexpr TakeIterator& operator++() {
-        ++_current;
+        --_amount;
         ++_iterator;
         return *this;
     }
@@ -45,7 +230,7 @@ public:
     }
 
     constexpr friend bool operator==(const TakeIterator& a, DefaultSentinel) noexcept {
-        return a._current == a._amount;
+        return a._amount <= 0 || a._iterator == a._last.get();
     }
 
     constexpr friend bool operator!=(const TakeIterator& a, DefaultSentinel s) noexcept {
@@ -60,27 +245,32 @@ public:
         return !(a == b);
     }
 
-#    ifdef __cpp_if_constexpr
-    EMBIT_CONSTEXPR_CXX_20 void swapView() noexcept {
-        if constexpr (std::is_same<Char, Sentinel>::value) {
-            std::swap(_iterator, _last);
+    template<class Sink>
+    EMBIT_CONSTEXPR_CXX_14 bool forEachWhile(Sink& sink) const {
+        if (_amount <= 0) {
+            return true;
         }
-        else {
-            _iterator.swapView();
-        }
-    }
-#    else
-    template<class I = Iterator>
-    EnableIf<std::is_same<I, Sentinel>::value> swapView() {
-        std::swap(_iterator, _last);
+        auto remaining = _amount;
+        bool stopped = false;
+        detail::forEachWhile(_iterator, _last.get(), TakeSink<Sink, difference_type>{ sink, remaining, stopped });
+        return !stopped;
     }
+};
+
+template<class Iterator, class Sentinel>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<IsRandomAccessIter<Iterator>::value, Iterator>
+safeNext(Iterator first, Sentinel last, const IterDiffType<Iterator> offset) {
+    const auto dist = last - first;
+    return first + (offset < 0 ? 0 : (offset < dist ? offset : dist));
+}
 
-    template<class I = Iterator>
-    EnableIf<!std::is_same<I, Sentinel>::value> swapView() {
-        _iterator.swapView();
+template<class Iterator, class Sentinel>
+EMBIT_CONSTEXPR_CXX_14 EnableIf<!IsRandomAccessIter<Iterator>::value, Iterator>
+safeNext(Iterator first, Sentinel last, IterDiffType<Iterator> offset) {
+    for (; offset > 0 && first != last; --offset, ++first) {
     }
-#    endif
-};
+    return first;
+}
 } // namespace detail
 
 template<class Iterator, class Sentinel>
@@ -89,28 +279,35 @@ public:
     using iterator = detail::TakeIterator<Iterator, Sentinel>;
     using const_iterator = iterator;
 
-    TakeView(Iterator iter, Sentinel last, const IterDiffType<Iterator> amount) :
-        View<iterator, DefaultSentinel>(iterator(std::move(iter), amount), defaultSentinel) {
+    constexpr TakeView(Iterator iter, Sentinel last, const IterDiffType<Iterator> amount) :
+        View<iterator, DefaultSentinel>(iterator(std::move(iter), std::move(last), amount), defaultSentinel) {
     }
 
     TakeView() = default;
+
+    template<class I = iterator>
+    constexpr auto size() const -> decltype(std::declval<I>().size()) {
+        return this->begin().size();
+    }
 };
 
 template<class V>
-auto take(V&& view, const IterDiffType<BeginIter<V>> amount) -> TakeView<decltype(std::begin(view)), decltype(std::end(view))> {
+constexpr auto take(V&& view, const IterDiffType<BeginIter<V>> amount)
+    -> TakeView<decltype(std::begin(view)), decltype(std::end(view))> {
     return { std::begin(view), std::end(view), amount };
 }
 
 template<class V>
-auto counted(V&& view, const IterDiffType<BeginIter<V>> amount)
+constexpr auto counted(V&& view, const IterDiffType<BeginIter<V>> amount)
     -> TakeView<decltype(std::begin(view)), decltype(std::end(view))> {
     return take(view, amount);
 }
 
 template<class V>
-auto slice(V&& view, const IterDiffType<BeginIter<V>> from, const IterDiffType<BeginIter<V>> to)
+EMBIT_CONSTEXPR_CXX_14 auto slice(V&& view, const IterDiffType<BeginIter<V>> from, const IterDiffType<BeginIter<V>> to)
     -> TakeView<decltype(std::begin(view)), decltype(std::end(view))> {
-    return { std::next(std::begin(view), from), std::end(view), to };
+    return { detail::safeNext(std::begin(view), std::end(view), from), std::end(view),
+             to < from ? 0 : to - (from < 0 ? 0 : from) };
 }
 } // namespace embit
 
@@ -0,0 +1,31 @@
+#pragma once
+
+#ifndef EMBIT_TO_ARRAY_HPP
+#    define EMBIT_TO_ARRAY_HPP
+
+#    include "Core.hpp"
+
+#    include <array>
+
+namespace embit {
+namespace detail {
+// Deliberately not constexpr: reaching it while evaluating a constant expression makes a size mismatch a compile error
+inline void toArraySizeMismatch() noexcept {
+}
+} // namespace detail
+
+// Materializes `view` into a std::array, e.g. to generate lookup tables at compile time. The view must have exactly N
+// elements: in constant expressions anything else fails to compile, at run time excess elements are dropped and missing
+// ones are value initialized
+template<std::size_t N, class V>
+EMBIT_CONSTEXPR_CXX_17 std::array<typename std::remove_cv<ViewValueType<V>>::type, N> toArray(V&& view) {
+    std::array<typename std::remove_cv<ViewValueType<V>>::type, N> array{};
+    const CollectIntoResult result = embit::view(view).collectInto(array);
+    if (result.written != N || result.truncated) {
+        detail::toArraySizeMismatch();
+    }
+    return array;
+}
+} // namespace embit
+
+#endif // EMBIT_TO_ARRAY_HPP
@@ -0,0 +1,148 @@
+#pragma once
+
+#ifndef EMBIT_TOP_K_HPP
+#    define EMBIT_TOP_K_HPP
+
+#    include "StaticVector.hpp"
+
+#    include <algorithm>
+
+namespace embit {
+namespace detail {
+// std::less<void> is C++14
+struct Less {
+    template<class A, class B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        return a < b;
+    }
+};
+
+// The heap keeps the worst of the elements selected so far at its root, so that a new element only has to beat the root
+template<class Compare>
+struct WorstFirst {
+    Compare& compare;
+
+    template<class A, class B>
+    EMBIT_CONSTEXPR_CXX_20 bool operator()(const A& a, const B& b) const {
+        return compare(b, a);
+    }
+};
+
+template<class Compare>
+struct Reversed {
+    Compare compare;
+
+    template<class A, class B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        return compare(b, a);
+    }
+};
+
+// Bounded containers are appended to until they are full, after which the heap is updated in place
+template<class Container, class Compare>
+struct BoundedTopKSink {
+    Container& container;
+    WorstFirst<Compare> heapCompare;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_20 bool operator()(T&& value) const {
+        if (!container.full()) {
+            container.push_back(std::forward<T>(value));
+            std::push_heap(container.begin(), container.end(), heapCompare);
+        }
+        else if (container.empty()) {
+            return false;
+        }
+        else if (heapCompare(value, container.front())) {
+            std::pop_heap(container.begin(), container.end(), heapCompare);
+            container.back() = std::forward<T>(value);
+            std::push_heap(container.begin(), container.end(), heapCompare);
+        }
+        return true;
+    }
+};
+
+// Other storage is used from its beginning, up to its size
+template<class Iterator, class Compare>
+struct OverwriteTopKSink {
+    Iterator first;
+    IterDiffType<Iterator> capacity;
+    IterDiffType<Iterator>& size;
+    WorstFirst<Compare> heapCompare;
+
+    template<class T>
+    EMBIT_CONSTEXPR_CXX_20 bool operator()(T&& value) const {
+        if (size < capacity) {
+            first[size] = std::forward<T>(value);
+            ++size;
+            std::push_heap(first, first + size, heapCompare);
+        }
+        else if (capacity == 0) {
+            return false;
+        }
+        else if (heapCompare(value, *first)) {
+            std::pop_heap(first, first + size, heapCompare);
+            first[size - 1] = std::forward<T>(value);
+            std::push_heap(first, first + size, heapCompare);
+        }
+        return true;
+    }
+};
+
+template<class V, class C, class Compare>
+EMBIT_CONSTEXPR_CXX_20 EnableIf<HasFull<C>::value, std::size_t> topKInto(const V& view, C& container, Compare& compare) {
+    container.clear();
+    detail::forEachWhile(view.begin(), view.end(), BoundedTopKSink<C, Compare>{ container, { compare } });
+    std::sort_heap(container.begin(), container.end(), WorstFirst<Compare>{ compare });
+    return container.size();
+}
+
+template<class V, class C, class Compare>
+EMBIT_CONSTEXPR_CXX_20 EnableIf<!HasFull<C>::value, std::size_t> topKInto(const V& view, C& storage, Compare& compare) {
+    using Iterator = decltype(std::begin(storage));
+    static_assert(IsRandomAccessIter<Iterator>::value, "Top k storage must be random access");
+    const Iterator first = std::begin(storage);
+    IterDiffType<Iterator> size = 0;
+    detail::forEachWhile(view.begin(), view.end(),
+                         OverwriteTopKSink<Iterator, Compare>{ first, std::end(storage) - first, size, { compare } });
+    std::sort_heap(first, first + size, WorstFirst<Compare>{ compare });
+    return static_cast<std::size_t>(size);
+}
+
+template<class Iterator>
+using TopKValue = typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type;
+} // namespace detail
+
+// Selects the `storage` size (or StaticVector capacity) greatest elements of `view` according to `compare` in one pass,
+// in O(n log k) time and no memory besides `storage`. They are written to the beginning of `storage`, greatest first, and
+// their amount is returned. Works on single pass views (streams, cstrings)
+template<class V, class Storage, class Compare = detail::Less>
+EMBIT_CONSTEXPR_CXX_20 std::size_t topKInto(V&& view, Storage&& storage, Compare compare = Compare()) {
+    return detail::topKInto(embit::view(std::begin(view), std::end(view)), storage, compare);
+}
+
+// Like topKInto, but selects the smallest elements, smallest first
+template<class V, class Storage, class Compare = detail::Less>
+EMBIT_CONSTEXPR_CXX_20 std::size_t bottomKInto(V&& view, Storage&& storage, Compare compare = Compare()) {
+    detail::Reversed<Compare> reversed{ std::move(compare) };
+    return detail::topKInto(embit::view(std::begin(view), std::end(view)), storage, reversed);
+}
+
+// The K greatest elements of `view`, greatest first, in a StaticVector so that nothing is allocated
+template<std::size_t K, class V, class Compare = detail::Less>
+EMBIT_CONSTEXPR_CXX_20 StaticVector<detail::TopKValue<BeginIter<V>>, K> topK(V&& view, Compare compare = Compare()) {
+    StaticVector<detail::TopKValue<BeginIter<V>>, K> result;
+    embit::topKInto(view, result, std::move(compare));
+    return result;
+}
+
+// The K smallest elements of `view`, smallest first
+template<std::size_t K, class V, class Compare = detail::Less>
+EMBIT_CONSTEXPR_CXX_20 StaticVector<detail::TopKValue<BeginIter<V>>, K> bottomK(V&& view, Compare compare = Compare()) {
+    StaticVector<detail::TopKValue<BeginIter<V>>, K> result;
+    embit::bottomKInto(view, result, std::move(compare));
+    return result;
+}
+} // namespace embit
+
+#endif // EMBIT_TOP_K_HPP
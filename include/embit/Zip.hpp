@@ -0,0 +1,184 @@
+#pragma once
+
+#ifndef EMBIT_ZIP_HPP
+#    define EMBIT_ZIP_HPP
+
+#    include "Core.hpp"
+
+#    include <tuple>
+#    include <utility>
+
+namespace embit {
+namespace detail {
+template<class T>
+constexpr T minimum(const T value) {
+    return value;
+}
+
+template<class T, class... Ts>
+constexpr T minimum(const T first, const T second, const Ts... rest) {
+    return minimum(first < second ? first : second, rest...);
+}
+
+template<class Iterators>
+struct IsRandomAccessZip;
+
+template<class... Iterators>
+struct IsRandomAccessZip<std::tuple<Iterators...>> : AllRandomAccess<Iterators...> {};
+
+template<class Iterators, class Sentinels, bool = IsRandomAccessZip<Iterators>::value>
+class ZipIterator;
+
+// Random access: the inputs are addressed by one shared index that runs up to the length of the shortest input, which is the
+// same loop as a hand written indexed one and vectorizes like it
+template<class... Iterators, class... Sentinels>
+class ZipIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>, true>
+    : public IndexIterator<ZipIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>, true>,
+                           std::tuple<IterRef<Iterators>...>, typename std::common_type<IterDiffType<Iterators>...>::type> {
+    using Indices = std::index_sequence_for<Iterators...>;
+    using Base = IndexIterator<ZipIterator, std::tuple<IterRef<Iterators>...>,
+                               typename std::common_type<IterDiffType<Iterators>...>::type>;
+
+public:
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using pointer = void;
+    using typename Base::reference;
+    using typename Base::difference_type;
+
+private:
+    std::tuple<Iterators...> _firsts{};
+
+    template<std::size_t... Is>
+    static constexpr difference_type length(const std::tuple<Iterators...>& firsts, const std::tuple<Sentinels...>& lasts,
+                                            std::index_sequence<Is...>) {
+        return minimum(static_cast<difference_type>(std::get<Is>(lasts) - std::get<Is>(firsts))...);
+    }
+
+    template<std::size_t... Is>
+    constexpr reference at(const difference_type index, std::index_sequence<Is...>) const {
+        return reference(std::get<Is>(_firsts)[static_cast<IterDiffType<Iterators>>(index)]...);
+    }
+
+public:
+    constexpr ZipIterator(std::tuple<Iterators...> firsts, const std::tuple<Sentinels...>& lasts) :
+        Base(0, length(firsts, lasts, Indices())),
+        _firsts(std::move(firsts)) {
+    }
+
+    ZipIterator() = default;
+
+    constexpr reference at(const difference_type index) const {
+        return at(index, Indices());
+    }
+};
+
+// Forward (or weaker): every input is advanced and the zip ends as soon as any of them does
+template<class... Iterators, class... Sentinels>
+class ZipIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>, false> {
+    using Indices = std::index_sequence_for<Iterators...>;
+
+    std::tuple<Iterators...> _iterators{};
+    std::tuple<Sentinels...> _lasts{};
+
+public:
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using reference = std::tuple<IterRef<Iterators>...>;
+    using pointer = void;
+    using difference_type = typename std::common_type<IterDiffType<Iterators>...>::type;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, IterCat<Iterators>...>::type;
+
+    constexpr ZipIterator(std::tuple<Iterators...> firsts, std::tuple<Sentinels...> lasts) :
+        _iterators(std::move(firsts)),
+        _lasts(std::move(lasts)) {
+    }
+
+    ZipIterator() = default;
+
+    constexpr reference operator*() const {
+        return dereference(Indices());
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ZipIterator& operator++() {
+        increment(Indices());
+        return *this;
+    }
+
+    EMBIT_CONSTEXPR_CXX_14 ZipIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    constexpr friend bool operator==(const ZipIterator& a, DefaultSentinel) {
+        return a.isAtEnd(Indices());
+    }
+
+    constexpr friend bool operator!=(const ZipIterator& a, DefaultSentinel s) {
+        return !(a == s);
+    }
+
+    constexpr friend bool operator==(const ZipIterator& a, const ZipIterator& b) {
+        return std::get<0>(a._iterators) == std::get<0>(b._iterators);
+    }
+
+    constexpr friend bool operator!=(const ZipIterator& a, const ZipIterator& b) {
+        return !(a == b);
+    }
+
+private:
+    template<std::size_t... Is>
+    constexpr reference dereference(std::index_sequence<Is...>) const {
+        return reference(*std::get<Is>(_iterators)...);
+    }
+
+    template<std::size_t... Is>
+    EMBIT_CONSTEXPR_CXX_14 void increment(std::index_sequence<Is...>) {
+        const int expand[] = { (++std::get<Is>(_iterators), 0)... };
+        static_cast<void>(expand);
+    }
+
+    template<std::size_t... Is>
+    EMBIT_CONSTEXPR_CXX_14 bool isAtEnd(std::index_sequence<Is...>) const {
+        const bool atEnd[] = { std::get<Is>(_iterators) == std::get<Is>(_lasts)... };
+        for (const bool end : atEnd) {
+            if (end) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+} // namespace detail
+
+template<class Iterators, class Sentinels>
+class ZipView;
+
+template<class... Iterators, class... Sentinels>
+class ZipView<std::tuple<Iterators...>, std::tuple<Sentinels...>>
+    : public View<detail::ZipIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>>, DefaultSentinel> {
+public:
+    using iterator = detail::ZipIterator<std::tuple<Iterators...>, std::tuple<Sentinels...>>;
+    using const_iterator = iterator;
+
+    constexpr ZipView(std::tuple<Iterators...> firsts, std::tuple<Sentinels...> lasts) :
+        View<iterator, DefaultSentinel>(iterator(std::move(firsts), std::move(lasts)), defaultSentinel) {
+    }
+
+    ZipView() = default;
+
+    template<class I = iterator>
+    constexpr auto size() const -> decltype(std::declval<I>().size()) {
+        return this->begin().size();
+    }
+};
+
+// Iterates all views in lockstep, yielding tuples of their references, and stops at the end of the shortest one. The zip is
+// random access and sized if all views are random access
+template<class... Vs>
+constexpr ZipView<std::tuple<BeginIter<Vs>...>, std::tuple<EndIter<Vs>...>> zip(Vs&&... views) {
+    static_assert(sizeof...(Vs) > 0, "At least one view is required");
+    return { std::tuple<BeginIter<Vs>...>(std::begin(views)...), std::tuple<EndIter<Vs>...>(std::end(views)...) };
+}
+} // namespace embit
+
+#endif // EMBIT_ZIP_HPP
@@ -0,0 +1,34 @@
+#include <catch2/catch.hpp>
+#include <embit/CString.hpp>
+#include <string>
+#include <vector>
+
+TEST_CASE("CString length is resolved in blocks") {
+    std::vector<char> buffer(256, 'a');
+
+    SECTION("Every offset and length") {
+        for (std::size_t offset = 0; offset < 64; ++offset) {
+            for (std::size_t length = 0; length < 128; ++length) {
+                buffer.assign(256, 'a');
+                buffer[offset + length] = '\0';
+                auto view = embit::cstring(buffer.data() + offset);
+                REQUIRE(view.size() == length);
+                REQUIRE(embit::distance(embit::toCommon(view)) == static_cast<std::ptrdiff_t>(length));
+            }
+        }
+    }
+
+    SECTION("Copy and collect") {
+        auto view = embit::cstring("hello world");
+        CHECK(view.distance() == 11);
+        CHECK(view.collectAs<std::string>() == "hello world");
+
+        std::string out;
+        embit::cstring("hello world", 5).copy(std::back_inserter(out));
+        CHECK(out == "hello");
+    }
+
+    SECTION("Wide characters") {
+        CHECK(embit::cstring(L"wide").size() == 4);
+    }
+}
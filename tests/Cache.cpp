@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+#include <embit/Cache.hpp>
+#include <embit/Chain.hpp>
+#include <embit/StaticVector.hpp>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <vector>
+
+TEST_CASE("Cache computes every element once") {
+    std::vector<int> v = { 1, 2, 3, 4 };
+    int calls = 0;
+    const auto expensive = [&calls](const int i) {
+        ++calls;
+        return i * 10;
+    };
+    const auto plus = [](const int acc, const int i) { return acc + i; };
+
+    SECTION("Consumed more than once") {
+        auto cached = embit::chain(v).map(expensive).cache();
+        CHECK(calls == 0);
+        CHECK(cached.foldl(plus, 0) == 100);
+        CHECK(cached.collectAs<std::vector<int>>() == std::vector<int>{ 10, 20, 30, 40 });
+        CHECK(embit::reverse(cached).collectAs<std::vector<int>>() == std::vector<int>{ 40, 30, 20, 10 });
+        CHECK(cached.back() == 40);
+        CHECK(cached.begin()[2] == 30);
+        CHECK(cached.distance() == 4);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Partially consumed") {
+        auto cached = embit::cache(embit::map(v, expensive));
+        auto it = cached.begin();
+        CHECK(*it == 10);
+        CHECK(*++it == 20);
+        CHECK(calls == 2);
+        CHECK(cached.forEachWhile([](const int i) { return i < 30; }) == false);
+        CHECK(calls == 3);
+        CHECK(cached.distance() == 4);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Caller provided buffer") {
+        std::vector<int> buffer = { 7, 7 };
+        buffer.reserve(v.size());
+        const std::list<int> l(v.begin(), v.end());
+        auto cached = embit::chain(l).map(expensive).cache(buffer);
+        CHECK(cached.foldl(plus, 0) == 100);
+        CHECK(buffer == std::vector<int>{ 10, 20, 30, 40 });
+        CHECK(cached.foldl(plus, 0) == 100);
+        CHECK(calls == 4);
+        CHECK(embit::chain(cached).map([](const int i) { return i + 1; }).collectAs<std::vector<int>>() ==
+              std::vector<int>{ 11, 21, 31, 41 });
+        CHECK(calls == 4);
+    }
+
+    SECTION("Fixed capacity buffer") {
+        embit::StaticVector<int, 4> buffer;
+        auto cached = embit::cache(embit::map(v, expensive), buffer);
+        auto moved = std::move(cached);
+        CHECK(moved.foldl(plus, 0) == 100);
+        CHECK(moved.back() == 40);
+        CHECK(buffer.size() == 4);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Single pass source") {
+        std::istringstream stream("1 2 3");
+        auto numbers = embit::cache(embit::view(std::istream_iterator<int>(stream), std::istream_iterator<int>()));
+        CHECK(numbers.foldl(plus, 0) == 6);
+        CHECK(numbers.foldl(plus, 0) == 6);
+        CHECK(numbers.size() == 3);
+    }
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Chunk.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("Chunk splits a view into fixed size sub views") {
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
+    const auto sum = [](const int acc, const int i) { return acc + i; };
+
+    SECTION("Random access") {
+        auto chunks = embit::chunk(v, 3);
+        static_assert(embit::detail::IsRandomAccessView<decltype(chunks)>::value, "Chunk over vector should be random access");
+        CHECK(chunks.size() == 3);
+        CHECK(chunks.distance() == 3);
+        CHECK(chunks.begin()[1].collectAs<std::vector<int>>() == std::vector<int>{ 4, 5, 6 });
+        CHECK(chunks.back().collectAs<std::vector<int>>() == std::vector<int>{ 7 });
+        CHECK(embit::chunk(v, 7).distance() == 1);
+        const std::vector<int> empty;
+        CHECK(embit::chunk(empty, 3).empty());
+        CHECK(embit::reverse(chunks).transformCollectAs<std::vector<int>>([&sum](const embit::View<int*, int*>& c) {
+            return c.foldl(sum, 0);
+        }) == std::vector<int>{ 7, 15, 6 });
+    }
+
+    SECTION("Contiguous chunks are pointer ranges") {
+        auto first = embit::chunk(v, 4).front();
+        static_assert(std::is_same<decltype(first.begin()), int*>::value, "Chunks of a vector should be pointer ranges");
+        CHECK(first.begin() == v.data());
+        CHECK(first.end() == v.data() + 4);
+    }
+
+    SECTION("Non contiguous random access") {
+        auto chunks = embit::chain(v).map([](const int i) { return i * 2; }).chunk(2);
+        CHECK(chunks.distance() == 4);
+        CHECK(chunks.begin()[3].collectAs<std::vector<int>>() == std::vector<int>{ 14 });
+        CHECK(chunks.take(2).map([&sum](decltype(chunks.front()) c) { return c.foldl(sum, 0); }).collectAs<std::vector<int>>() ==
+              std::vector<int>{ 6, 14 });
+    }
+
+    SECTION("Forward") {
+        std::list<int> l(v.begin(), v.end());
+        auto chunks = embit::chunk(l, 3);
+        CHECK(chunks.distance() == 3);
+        CHECK(chunks.front().collectAs<std::vector<int>>() == std::vector<int>{ 1, 2, 3 });
+        auto it = chunks.begin();
+        ++it;
+        ++it;
+        CHECK((*it).front() == 7);
+        CHECK(embit::chunk(l, 1).distance() == 7);
+    }
+
+    SECTION("Chunk sizes of 0 or less yield no chunks") {
+        CHECK(embit::chunk(v, 0).empty());
+        CHECK(embit::chunk(v, -2).size() == 0);
+        std::list<int> l(v.begin(), v.end());
+        CHECK(embit::chunk(l, 0).empty());
+        CHECK(embit::chunk(l, -1).distance() == 0);
+    }
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+#include <embit/Concat.hpp>
+#include <embit/Map.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("Concat joins any amount of views segment by segment") {
+    std::vector<int> a = { 1, 2 };
+    std::vector<int> empty;
+    std::vector<int> b = { 3 };
+    std::vector<int> c = { 4, 5, 6 };
+    const auto concatDigits = [](const int acc, const int i) { return acc * 10 + i; };
+
+    SECTION("Iteration") {
+        auto concatenated = embit::concat(empty, a, empty, b, c, empty);
+        int result = 0;
+        for (const int i : concatenated) {
+            result = concatDigits(result, i);
+        }
+        CHECK(result == 123456);
+        CHECK(concatenated.foldl(concatDigits, 0) == 123456);
+        CHECK(embit::concat(empty, empty).empty());
+        CHECK(embit::concat(a).foldl(concatDigits, 0) == 12);
+
+        std::list<int> l = { 7, 8 };
+        CHECK(embit::concat(c, l).foldl(concatDigits, 0) == 45678);
+    }
+
+    SECTION("Random access and size") {
+        auto concatenated = embit::concat(a, empty, b, c);
+        static_assert(embit::detail::IsRandomAccessView<decltype(concatenated)>::value,
+                      "Concat of vectors should be random access");
+        CHECK(concatenated.size() == 6);
+        CHECK(concatenated.distance() == 6);
+        CHECK(concatenated.back() == 6);
+        CHECK(concatenated.begin()[2] == 3);
+        CHECK(concatenated.begin()[5] == 6);
+
+        auto it = concatenated.begin() + 5;
+        CHECK(*it == 6);
+        it -= 4;
+        CHECK(*it == 2);
+        --it;
+        CHECK(*it == 1);
+        CHECK((it + 6) == embit::defaultSentinel);
+        CHECK((concatenated.begin() + 4) - concatenated.begin() == 4);
+
+        const auto common = embit::toCommon(concatenated);
+        CHECK(std::vector<int>(common.begin(), common.end()) == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+        CHECK(concatenated.collectAs<std::vector<int>>().capacity() == 6);
+    }
+
+    SECTION("Bidirectional segments") {
+        std::list<int> l = { 7, 8 };
+        std::list<int> emptyList;
+        auto concatenated = embit::concat(l, emptyList, l, emptyList);
+        CHECK(concatenated.back() == 8);
+        CHECK(embit::concat(l, emptyList).back() == 8);
+        CHECK(embit::concat(emptyList, l).back() == 8);
+        auto it = concatenated.begin();
+        CHECK(*it == 7);
+        CHECK(*++it == 8);
+        CHECK(*++it == 7);
+        CHECK(*--it == 8);
+    }
+
+    SECTION("Appending segments") {
+        auto appended = embit::concat(a, b).concat(c).concat(embit::map(a, [](const int i) { return i + 6; }));
+        CHECK(appended.foldl(concatDigits, 0) == 12345678);
+        CHECK(appended.size() == 8);
+    }
+}
@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Drop.hpp>
+#include <embit/Range.hpp>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <vector>
+
+namespace {
+// Counts how often it is advanced, to check when a forward drop does its work
+struct CountingIterator {
+    using value_type = int;
+    using reference = int;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    int value{};
+    int* increments{ nullptr };
+
+    int operator*() const {
+        return value;
+    }
+
+    CountingIterator& operator++() {
+        ++value;
+        ++*increments;
+        return *this;
+    }
+
+    CountingIterator operator++(int) {
+        auto tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const CountingIterator& a, const CountingIterator& b) {
+        return a.value == b.value;
+    }
+
+    friend bool operator!=(const CountingIterator& a, const CountingIterator& b) {
+        return !(a == b);
+    }
+};
+} // namespace
+
+TEST_CASE("Drop skips the first elements") {
+    SECTION("Random access keeps iterators and size") {
+        std::vector<int> values{ 1, 2, 3, 4, 5 };
+        auto dropped = embit::drop(values, 2);
+        static_assert(std::is_same<decltype(dropped.begin()), std::vector<int>::iterator>::value,
+                      "Random access drop should keep the iterators");
+        CHECK(dropped.begin() == values.begin() + 2);
+        CHECK(dropped.distance() == 3);
+        CHECK(dropped.collectAs<std::vector<int>>() == std::vector<int>{ 3, 4, 5 });
+    }
+
+    SECTION("Dropping more than the size yields an empty view") {
+        std::vector<int> values{ 1, 2, 3 };
+        CHECK(embit::drop(values, 10).empty());
+        std::list<int> list{ 1, 2, 3 };
+        CHECK(embit::drop(list, 10).empty());
+        CHECK(embit::drop(values, 0).distance() == 3);
+    }
+
+    SECTION("Default sentinel sources") {
+        auto dropped = embit::drop(embit::range(10), 7);
+        static_assert(embit::detail::IsRandomAccessView<decltype(dropped)>::value, "Drop should keep random access");
+        CHECK(dropped.collectAs<std::vector<int>>() == std::vector<int>{ 7, 8, 9 });
+        CHECK(embit::distance(dropped) == 3);
+    }
+
+    SECTION("Forward sources") {
+        std::forward_list<int> values{ 1, 2, 3, 4 };
+        auto dropped = embit::drop(values, 1);
+        CHECK(dropped.collectAs<std::vector<int>>() == std::vector<int>{ 2, 3, 4 });
+        std::vector<int> iterated;
+        for (auto it = dropped.begin(); it != dropped.end(); ++it) {
+            iterated.push_back(*it);
+        }
+        CHECK(iterated == std::vector<int>{ 2, 3, 4 });
+        CHECK(embit::toCommon(dropped).distance() == 3);
+    }
+
+    SECTION("Forward sources are advanced on first use, once") {
+        int increments = 0;
+        const CountingIterator first{ 0, &increments };
+        const CountingIterator last{ 10, &increments };
+        auto dropped = embit::drop(embit::view(first, last), 4);
+        auto it = dropped.begin();
+        CHECK(increments == 0);
+        ++it;
+        CHECK(increments == 5);
+        CHECK(*it == 5);
+        CHECK(it != dropped.end());
+        CHECK(increments == 5);
+    }
+
+    SECTION("Const views are not written to") {
+        int increments = 0;
+        const CountingIterator first{ 0, &increments };
+        const CountingIterator last{ 10, &increments };
+        const auto dropped = embit::drop(embit::view(first, last), 4);
+        CHECK(dropped.front() == 4);
+        CHECK(dropped.front() == 4);
+        CHECK(increments == 8);
+        CHECK(dropped.collectAs<std::vector<int>>() == std::vector<int>{ 4, 5, 6, 7, 8, 9 });
+        CHECK(dropped.distance() == 6);
+    }
+
+    SECTION("Chained and adapted forward drops stay lazy") {
+        int increments = 0;
+        const CountingIterator first{ 0, &increments };
+        const CountingIterator last{ 10, &increments };
+        const auto chained = embit::chain(embit::view(first, last)).skip(4);
+        const auto mapped = embit::map(embit::drop(embit::view(first, last), 4), [](const int i) { return i * 10; });
+        CHECK(increments == 0);
+        CHECK(chained.foldl(std::plus<int>(), 0) == 39);
+        CHECK(increments == 10);
+        CHECK(mapped.collectAs<std::vector<int>>() == std::vector<int>{ 40, 50, 60, 70, 80, 90 });
+        CHECK(increments == 20);
+    }
+
+    SECTION("Negative counts drop nothing") {
+        std::vector<int> values{ 1, 2, 3 };
+        CHECK(embit::drop(values, -2).begin() == values.begin());
+        CHECK(embit::drop(values, -2).distance() == 3);
+        std::list<int> list{ 1, 2, 3 };
+        CHECK(embit::drop(list, -2).collectAs<std::vector<int>>() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Chain") {
+        std::vector<int> values{ 1, 2, 3, 4, 5 };
+        CHECK(embit::chain(values).skip(1).take(2).collectAs<std::vector<int>>() == std::vector<int>{ 2, 3 });
+        CHECK(embit::chain(values).map([](const int i) { return i * 10; }).drop(3).collectAs<std::vector<int>>() ==
+              std::vector<int>{ 40, 50 });
+        std::list<int> list{ 1, 2, 3 };
+        CHECK(embit::chain(list).drop(2).collectAs<std::vector<int>>() == std::vector<int>{ 3 });
+    }
+}
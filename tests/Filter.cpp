@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("Filter pushes elements through forEachWhile") {
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6 };
+    auto filtered = embit::filter(embit::map(v, [](const int i) { return i * 3; }), [](const int i) { return i % 2 == 0; });
+#if EMBIT_HAS_ATTRIBUTE(no_unique_address)
+    static_assert(sizeof(filtered.begin()) == 2 * sizeof(int*),
+                  "Captureless lambdas and default sentinels should not take up space in a filter iterator");
+#endif
+
+    SECTION("Terminal operations") {
+        CHECK(filtered.foldl([](const int acc, const int i) { return acc + i; }, 0) == 36);
+        CHECK(filtered.collectAs<std::vector<int>>() == std::vector<int>{ 6, 12, 18 });
+        CHECK(filtered.back() == 18);
+    }
+
+    SECTION("Early exit") {
+        int visited = 0;
+        const bool completed = filtered.forEachWhile([&visited](const int) { return ++visited < 2; });
+        CHECK_FALSE(completed);
+        CHECK(visited == 2);
+    }
+
+    SECTION("Take over a forward source") {
+        std::list<int> l = { 1, 2, 3, 4, 5 };
+        auto taken = embit::take(embit::filter(l, [](const int i) { return i != 2; }), 3);
+        CHECK(taken.foldl([](const int acc, const int i) { return acc * 10 + i; }, 0) == 134);
+    }
+
+    SECTION("Chain forEach") {
+        int sum = 0;
+        embit::chain(v)
+            .map([](const int i) { return i + 1; })
+            .filter([](const int i) { return i > 3; })
+            .forEach([&sum](const int i) { sum += i; });
+        CHECK(sum == 22);
+    }
+}
+
+TEST_CASE("Filter over arithmetic sources is evaluated in batches") {
+    std::vector<int> v(1000);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<int>((i * 7919) % 257);
+    }
+    const auto& constV = v;
+    const auto isOdd = [](const int i) { return i % 2 != 0; };
+
+    std::vector<int> expected;
+    for (const int i : v) {
+        if (isOdd(i)) {
+            expected.push_back(i);
+        }
+    }
+
+    CHECK(embit::filter(constV, isOdd).collectAs<std::vector<int>>() == expected);
+    CHECK(embit::filter(v, isOdd).collectAs<std::vector<int>>() == expected);
+    CHECK(embit::filter(constV, isOdd).foldl([](const int acc, const int) { return acc + 1; }, 0) ==
+          static_cast<int>(expected.size()));
+
+    SECTION("Predicates taking mutable references") {
+        CHECK(embit::filter(v, [](int& i) { return i % 2 != 0; }).collectAs<std::vector<int>>() == expected);
+    }
+
+    SECTION("Predicates are not evaluated past where the consumer stops") {
+        int calls = 0;
+        const auto countingIsOdd = [&calls](const int i) {
+            ++calls;
+            return i % 2 != 0;
+        };
+        CHECK(embit::chain(constV).filter(countingIsOdd).take(1).collectAs<std::vector<int>>() == std::vector<int>{ v[1] });
+        // The first survivor is found when the filter is constructed and tested again when it is pushed
+        CHECK(calls == 3);
+    }
+
+    SECTION("Mutable sources still hand out references") {
+        embit::chain(v).filter(isOdd).forEach([](int& i) { i = 0; });
+        CHECK(embit::filter(v, isOdd).distance() == 0);
+    }
+}
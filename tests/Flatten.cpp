@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+#include <embit/Flatten.hpp>
+#include <list>
+#include <vector>
+
+namespace {
+// A sized range that counts how often it is asked for its size
+struct CountedList {
+    std::list<int> values;
+    int* sizeCalls;
+
+    std::list<int>::const_iterator begin() const {
+        return values.begin();
+    }
+
+    std::list<int>::const_iterator end() const {
+        return values.end();
+    }
+
+    std::size_t size() const {
+        ++*sizeCalls;
+        return values.size();
+    }
+};
+} // namespace
+
+TEST_CASE("Flatten detects its depth and iterates segment-wise") {
+    std::vector<std::vector<int>> nested = { { 1, 2 }, {}, { 3 }, { 4, 5, 6 }, {} };
+    auto flattened = embit::flatten(nested);
+    const auto concatDigits = [](const int acc, const int i) { return acc * 10 + i; };
+
+    SECTION("Iteration") {
+        int result = 0;
+        for (const int i : flattened) {
+            result = concatDigits(result, i);
+        }
+        CHECK(result == 123456);
+        CHECK(flattened.foldl(concatDigits, 0) == 123456);
+        CHECK(embit::reverse(flattened).foldl(concatDigits, 0) == 654321);
+    }
+
+    SECTION("Size") {
+        static_assert(!embit::detail::IsSizedView<decltype(flattened)>::value, "Flatten should not claim an O(1) size");
+        CHECK(flattened.distance() == 6);
+        CHECK(flattened.collectAs<std::vector<int>>() == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+    }
+
+    SECTION("Deeper nesting and other sources") {
+        std::vector<std::vector<std::vector<int>>> deeper = { { { 1 }, { 2, 3 } }, {}, { { 4 } } };
+        CHECK(embit::flatten(deeper).foldl(concatDigits, 0) == 1234);
+
+        std::list<std::list<int>> lists = { { 1 }, { 2, 3 } };
+        CHECK(embit::flatten(lists).distance() == 3);
+
+        int array[2][3] = { { 1, 2, 3 }, { 4, 5, 6 } };
+        CHECK(embit::flatten(array).distance() == 6);
+    }
+
+    SECTION("The free distance uses the sizes of the inner ranges") {
+        CHECK(embit::distance(flattened) == flattened.distance());
+        int sizeCalls = 0;
+        const std::vector<CountedList> lists = { { { 1, 2 }, &sizeCalls }, { {}, &sizeCalls }, { { 3, 4, 5 }, &sizeCalls } };
+        CHECK(embit::distance(embit::flatten(lists)) == 5);
+        CHECK(sizeCalls == 3);
+    }
+}
@@ -0,0 +1,31 @@
+#include <catch2/catch.hpp>
+#include <embit/Join.hpp>
+#include <list>
+#include <string>
+
+TEST_CASE("Join writes delimiters in bulk") {
+    std::string str = "hello";
+    auto joined = embit::join(str, ", ");
+
+    SECTION("Iteration") {
+        std::string result;
+        for (const char c : joined) {
+            result += c;
+        }
+        CHECK(result == "h, e, l, l, o");
+    }
+
+    SECTION("Size") {
+        CHECK(joined.size() == 13);
+        CHECK(joined.distance() == 13);
+        CHECK(embit::join(std::list<char>{ 'a', 'b' }, "--").distance() == 4);
+    }
+
+    SECTION("Copy and collect") {
+        char buffer[32]{};
+        char* end = joined.copy(buffer);
+        CHECK(std::string(+buffer, end) == "h, e, l, l, o");
+        CHECK(joined.collectAs<std::string>() == "h, e, l, l, o");
+        CHECK(embit::join(std::string(), ",").collectAs<std::string>().empty());
+    }
+}
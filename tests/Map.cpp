@@ -1,3 +1,75 @@
+#include <algorithm>
 #include <catch2/catch.hpp>
+#include <embit/Map.hpp>
+#include <list>
+#include <vector>
 
+TEST_CASE("Map propagates random access") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+    auto mapped = embit::map(v, [](const int i) { return i * 2; });
 
+    static_assert(embit::detail::IsRandomAccessView<decltype(mapped)>::value, "Map over vector should be random access");
+
+    SECTION("Distance") {
+        CHECK(mapped.distance() == 5);
+        CHECK(embit::distance(embit::map(mapped, [](const int i) { return i + 1; })) == 5);
+    }
+
+    SECTION("Indexing and arithmetic") {
+        auto begin = mapped.begin();
+        CHECK(begin[3] == 8);
+        CHECK(*(begin + 4) == 10);
+        CHECK(*((begin + 4) - 2) == 6);
+    }
+
+    SECTION("Binary search") {
+        auto common = embit::toCommon(mapped);
+        auto it = std::lower_bound(common.begin(), common.end(), 6);
+        CHECK(it - common.begin() == 2);
+        CHECK(common.begin() < common.end());
+    }
+}
+
+TEST_CASE("Map collects with a single allocation") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+    auto mapped = embit::map(v, [](const int i) { return i * 2; });
+
+    auto asVector = mapped.collectAs<std::vector<int>>();
+    CHECK(asVector == std::vector<int>{ 2, 4, 6, 8, 10 });
+    CHECK(asVector.capacity() == v.size());
+
+    auto withAllocator = mapped.collectAs<std::vector<int>>(std::allocator<int>());
+    CHECK(withAllocator.capacity() == v.size());
+
+    auto asList = mapped.collectAs<std::list<int>>();
+    CHECK(asList.back() == 10);
+}
+
+static int negate(const int i) {
+    return -i;
+}
+
+TEST_CASE("Map iterators add no storage for stateless functions") {
+    int array[] = { 1, 2, 3 };
+    const auto timesTwo = [](const int i) { return i * 2; };
+    auto first = embit::map(array, timesTwo).begin();
+
+#if EMBIT_HAS_ATTRIBUTE(no_unique_address)
+    static_assert(sizeof(first) == 2 * sizeof(int*), "Captureless lambdas should not take up space in a map iterator");
+    static_assert(sizeof(embit::map(array, &negate).begin()) == 3 * sizeof(int*),
+                  "Function pointers should be stored without a construction flag");
+#endif
+    // Trivial copies and destruction let the iterator be passed in registers
+    static_assert(std::is_trivially_copy_constructible<decltype(first)>::value &&
+                      std::is_trivially_destructible<decltype(first)>::value,
+                  "Iterators over trivial functions should be trivially copyable");
+
+    const int offset = 10;
+    auto shifted = embit::map(array, [offset](const int i) { return i + offset; }).begin();
+    auto other = shifted;
+    ++other;
+    shifted = other;
+    CHECK(*shifted == 12);
+    first = embit::map(array, timesTwo).begin() + 2;
+    CHECK(*first == 6);
+}
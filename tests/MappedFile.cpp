@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/MappedFile.hpp>
+
+#ifdef EMBIT_HAS_POSIX
+#    include <cstdlib>
+#    include <string>
+#    include <unistd.h>
+#    include <utility>
+
+namespace {
+// Creates a file with `contents` that is removed again at the end of the test
+class TemporaryFile {
+    std::string _path;
+
+public:
+    explicit TemporaryFile(const std::string& contents) {
+        char path[] = "/tmp/embit-mapped-XXXXXX";
+        const int fd = ::mkstemp(path);
+        REQUIRE(fd >= 0);
+        REQUIRE(::write(fd, contents.data(), contents.size()) == static_cast<::ssize_t>(contents.size()));
+        ::close(fd);
+        _path = path;
+    }
+
+    ~TemporaryFile() {
+        ::unlink(_path.c_str());
+    }
+
+    const std::string& path() const {
+        return _path;
+    }
+};
+} // namespace
+
+TEST_CASE("MappedFile views the bytes of a file") {
+    SECTION("Contents and size") {
+        const TemporaryFile file("first line\nsecond line\n");
+        const auto mapped = embit::mappedFile(file.path());
+        CHECK(mapped.size() == 23);
+        CHECK(mapped.collectAs<std::string>() == "first line\nsecond line\n");
+    }
+
+    SECTION("Null bytes are part of the contents") {
+        const std::string contents("a\0b", 3);
+        const TemporaryFile file(contents);
+        const auto mapped = embit::mappedFile(file.path());
+        CHECK(mapped.size() == 3);
+        CHECK(mapped.collectAs<std::string>() == contents);
+    }
+
+    SECTION("Empty file") {
+        const TemporaryFile file("");
+        const auto mapped = embit::mappedFile(file.path());
+        CHECK(mapped.empty());
+        CHECK(mapped.size() == 0);
+        CHECK(mapped.collectAs<std::string>().empty());
+    }
+
+    SECTION("Composes with other views") {
+        const TemporaryFile file("one\ntwo\nthree\n");
+        const auto mapped = embit::mappedFile(file.path());
+        const auto lines = embit::chain(mapped).filter([](const char c) { return c == '\n'; }).distance();
+        CHECK(lines == 3);
+        CHECK(embit::chain(mapped).take(3).collectAs<std::string>() == "one");
+    }
+
+    SECTION("Moving transfers the mapping") {
+        const TemporaryFile file("contents");
+        auto mapped = embit::mappedFile(file.path());
+        const char* data = mapped.data();
+        embit::MappedFile moved(std::move(mapped));
+        CHECK(moved.data() == data);
+        CHECK(moved.collectAs<std::string>() == "contents");
+        CHECK(mapped.empty());
+
+        const TemporaryFile other("other");
+        moved = embit::mappedFile(other.path());
+        CHECK(moved.collectAs<std::string>() == "other");
+    }
+
+    SECTION("Missing files throw") {
+        CHECK_THROWS_AS(embit::mappedFile("/nonexistent/embit/file"), std::system_error);
+    }
+}
+#endif // EMBIT_HAS_POSIX
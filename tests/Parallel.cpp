@@ -0,0 +1,57 @@
+#include <catch2/catch.hpp>
+#include <embit/Map.hpp>
+#include <embit/Parallel.hpp>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("Parallel fold splits random access views into deterministic chunks") {
+    std::vector<int> v(100000);
+    std::iota(v.begin(), v.end(), 0);
+    const auto plus = [](const long long a, const long long b) { return a + b; };
+    const long long expected = 99999LL * 100000 / 2;
+
+    SECTION("Reduce") {
+        CHECK(embit::reduce(v, plus, 0LL) == expected);
+        CHECK(embit::reduce(v, plus, 0LL, 7) == expected);
+        CHECK(embit::reduce(v, plus, 0LL, 1) == expected);
+
+        embit::ThreadPool pool(3);
+        CHECK(embit::reduce(v, plus, 0LL, 16, pool) == expected);
+        embit::ThreadPool noWorkers(0);
+        CHECK(embit::reduce(v, plus, 0LL, 4, noWorkers) == expected);
+
+        std::vector<int> empty;
+        CHECK(embit::reduce(empty, plus, 42LL) == 42);
+    }
+
+    SECTION("Mapped views and separate fold") {
+        auto doubled = embit::map(v, [](const int i) { return static_cast<long long>(i) * 2; });
+        CHECK(embit::reduce(doubled, plus, 0LL, 5) == expected * 2);
+
+        const auto countOdd = [](const std::size_t acc, const int i) { return acc + static_cast<std::size_t>(i % 2); };
+        const auto add = [](const std::size_t a, const std::size_t b) { return a + b; };
+        CHECK(embit::parallelFoldl(v, countOdd, add, std::size_t{ 0 }, 6) == 50000);
+    }
+
+    SECTION("Partial results are combined in order") {
+        std::vector<char> chars(3 * EMBIT_PARALLEL_GRAIN_SIZE, 'a');
+        chars.back() = 'z';
+        const auto append = [](std::string acc, const char c) { return acc += c; };
+        const auto concat = [](std::string a, const std::string& b) { return a += b; };
+        const std::string joined = embit::parallelFoldl(chars, append, concat, std::string(), 3);
+        CHECK(joined.size() == chars.size());
+        CHECK(joined.back() == 'z');
+    }
+
+    SECTION("Exceptions are rethrown on the calling thread") {
+        const auto throwing = [](const long long acc, const int i) -> long long {
+            if (i == 99999) {
+                throw std::runtime_error("fold failed");
+            }
+            return acc + i;
+        };
+        CHECK_THROWS_AS(embit::parallelFoldl(v, throwing, plus, 0LL, 8), std::runtime_error);
+    }
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Probe.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("Tap sees every element") {
+    std::vector<int> values{ 1, 2, 3, 4 };
+    int sum = 0;
+    const auto doubled = embit::chain(values).tap([&sum](const int i) { sum += i; }).map([](const int i) { return i * 2; });
+    CHECK(doubled.collectAs<std::vector<int>>() == std::vector<int>{ 2, 4, 6, 8 });
+    CHECK(sum == 10);
+
+    SECTION("References are passed through") {
+        auto tapped = embit::tap(values, [](const int) {});
+        *tapped.begin() = 5;
+        CHECK(values.front() == 5);
+    }
+}
+
+#ifdef EMBIT_INSTRUMENT
+TEST_CASE("Probes count the elements that pass them") {
+    const std::vector<int> values{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+    SECTION("Filter pass ratio") {
+        embit::ProbeStats before;
+        embit::ProbeStats after;
+        const auto sum = embit::chain(values)
+                             .probe(before)
+                             .filter([](const int i) { return i % 2 == 0; })
+                             .probe(after)
+                             .foldl([](const int acc, const int i) { return acc + i; }, 0);
+        CHECK(sum == 30);
+        CHECK(before.elements == 10);
+        CHECK(after.elements == 5);
+        CHECK(embit::passRatio(before, after) == Approx(0.5));
+#    ifdef EMBIT_INSTRUMENT_CYCLES
+        // The probe after the filter times the filtering
+        CHECK(after.cycles > 0);
+#    endif // EMBIT_INSTRUMENT_CYCLES
+    }
+
+    SECTION("External iteration") {
+        embit::ProbeStats stats;
+        auto probed = embit::chain(values).probe(stats).take(3);
+        for (auto it = probed.begin(); it != probed.end(); ++it) {
+            static_cast<void>(*it);
+        }
+        CHECK(stats.elements == 3);
+    }
+
+    SECTION("Probes keep the iterator category") {
+        embit::ProbeStats stats;
+        auto probed = embit::probe(values, stats);
+        static_assert(embit::detail::IsRandomAccessView<decltype(probed)>::value, "Probe should be random access");
+        CHECK(probed.distance() == 10);
+        CHECK(stats.elements == 0);
+    }
+
+    SECTION("Named probes") {
+        embit::resetProbes();
+        embit::chain(values).probe("source").filter([](const int i) { return i > 7; }).probe("filtered").forEach([](int) {});
+        CHECK(embit::probeStats("source").elements == 10);
+        CHECK(embit::probeStats("filtered").elements == 3);
+        embit::resetProbes();
+        CHECK(embit::probeStats("source").elements == 0);
+    }
+}
+#else
+TEST_CASE("Probes compile to nothing without EMBIT_INSTRUMENT") {
+    const std::vector<int> values{ 1, 2, 3 };
+    embit::ProbeStats stats;
+    auto chained = embit::chain(values);
+    auto probed = chained.probe(stats).probe("name");
+    static_assert(std::is_same<decltype(probed), decltype(chained)>::value, "Probe should return the view itself");
+    static_assert(std::is_same<decltype(embit::probe(values, stats).begin()), decltype(values.begin())>::value,
+                  "Probe should not wrap the iterators");
+    CHECK(probed.collectAs<std::vector<int>>() == values);
+    CHECK(stats.elements == 0);
+}
+#endif // EMBIT_INSTRUMENT
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Range.hpp>
+#include <limits>
+#include <vector>
+
+namespace {
+struct Plus {
+    constexpr int operator()(const int a, const int b) const {
+        return a + b;
+    }
+};
+} // namespace
+
+TEST_CASE("Range generates arithmetic sequences") {
+    SECTION("Bounds and steps") {
+        CHECK(embit::range(5).collectAs<std::vector<int>>() == std::vector<int>{ 0, 1, 2, 3, 4 });
+        CHECK(embit::range(2, 5).collectAs<std::vector<int>>() == std::vector<int>{ 2, 3, 4 });
+        CHECK(embit::range(0, 10, 3).collectAs<std::vector<int>>() == std::vector<int>{ 0, 3, 6, 9 });
+        CHECK(embit::range(10, 0, -4).collectAs<std::vector<int>>() == std::vector<int>{ 10, 6, 2 });
+        CHECK(embit::range(5, 0).empty());
+        CHECK(embit::range(0, 5, 0).empty());
+        CHECK(embit::range(0.0, 1.0, 0.25).collectAs<std::vector<double>>() == std::vector<double>{ 0.0, 0.25, 0.5, 0.75 });
+        CHECK(embit::range(0.0, 1.0, 0.3).distance() == 4);
+    }
+
+    SECTION("Random access and closed form") {
+        auto r = embit::range(0, 100, 7);
+        static_assert(embit::detail::IsRandomAccessView<decltype(r)>::value, "Range should be random access");
+        CHECK(r.size() == 15);
+        CHECK(r.back() == 98);
+        CHECK(r.begin()[3] == 21);
+        CHECK(embit::reverse(embit::range(0, 4)).collectAs<std::vector<int>>() == std::vector<int>{ 3, 2, 1, 0 });
+    }
+
+    SECTION("Bounds at the limits of the type") {
+        constexpr int max = (std::numeric_limits<int>::max)();
+        constexpr int min = (std::numeric_limits<int>::min)();
+        CHECK(embit::range(0, max, 2).size() == 1073741824);
+        CHECK(embit::range(0, max, 2).back() == max - 1);
+        constexpr auto length = static_cast<std::ptrdiff_t>(static_cast<unsigned>(max) - static_cast<unsigned>(min));
+        if (length > 0) {
+            CHECK(embit::range(min, max).size() == length);
+            CHECK(embit::range(min, max).begin()[length - 1] == max - 1);
+        }
+        CHECK(embit::range(min, max).back() == max - 1);
+        CHECK(embit::range(max - 2, max).collectAs<std::vector<int>>() == std::vector<int>{ max - 2, max - 1 });
+        CHECK(embit::range(max, min, min).collectAs<std::vector<int>>() == std::vector<int>{ max, -1 });
+        CHECK(embit::range(min + 1, min, -1).collectAs<std::vector<int>>() == std::vector<int>{ min + 1 });
+        CHECK(embit::range<signed char>(-128, 127).size() == 255);
+        static_assert(embit::range(min, max, max).size() == 3, "size should not overflow");
+        constexpr auto ptrdiffMax = (std::numeric_limits<std::ptrdiff_t>::max)();
+        constexpr long long longMin = (std::numeric_limits<long long>::min)();
+        constexpr long long longMax = (std::numeric_limits<long long>::max)();
+        CHECK(embit::range(longMin, longMax).size() == ptrdiffMax);
+        CHECK(!embit::range(longMin, longMax).empty());
+        CHECK(embit::range(longMin, longMax).front() == longMin);
+    }
+
+    SECTION("Non finite floating point bounds") {
+        constexpr double infinity = (std::numeric_limits<double>::infinity)();
+        CHECK(embit::range(0.0, infinity).empty());
+        CHECK(embit::range(0.0, 1.0, 0.0).empty());
+        CHECK(embit::range(0.0, (std::numeric_limits<double>::quiet_NaN)()).empty());
+        CHECK(embit::range(0.0, 1e30, 1e-3).size() == (std::numeric_limits<std::ptrdiff_t>::max)());
+    }
+
+    SECTION("Composes with adaptors") {
+        auto squares = embit::chain(embit::iota(1)).map([](const int i) { return i * i; }).take(4);
+        static_assert(embit::detail::IsRandomAccessView<decltype(squares)>::value, "Taking from iota should be random access");
+        CHECK(squares.collectAs<std::vector<int>>() == std::vector<int>{ 1, 4, 9, 16 });
+        CHECK(embit::chain(embit::iota(0, 5)).take(3).back() == 10);
+        CHECK(embit::chain(embit::range(10)).filter([](const int i) { return i % 3 == 0; }).foldl(Plus(), 0) == 18);
+    }
+
+    SECTION("Constant expressions") {
+        static_assert(embit::range(0, 10, 3).size() == 4, "size should be usable at compile time");
+        static_assert(embit::range(1, 5).foldl(Plus(), 0) == 10, "Ranges should be folded at compile time");
+#ifdef EMBIT_HAS_CXX_17
+        static_assert(embit::range(0, 10, 3).back() == 9, "back should be usable at compile time");
+        static_assert(embit::take(embit::iota(3), 2).foldl(Plus(), 0) == 7, "iota should be usable at compile time");
+#endif // EMBIT_HAS_CXX_17
+    }
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Split.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+template<class V>
+std::vector<std::string> tokens(const V& split) {
+    std::vector<std::string> result;
+    for (auto it = split.begin(); it != split.end(); ++it) {
+        result.push_back((*it).template collectAs<std::string>());
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Split yields tokens between delimiters") {
+    SECTION("Single character delimiter") {
+        CHECK(tokens(embit::split(embit::cstring("a,bc,def"), ',')) == std::vector<std::string>{ "a", "bc", "def" });
+        CHECK(tokens(embit::split(embit::cstring("no delimiter"), ',')) == std::vector<std::string>{ "no delimiter" });
+    }
+
+    SECTION("Multi character delimiter") {
+        CHECK(tokens(embit::split(embit::cstring("a\r\nb\r\n\rc"), "\r\n")) == std::vector<std::string>{ "a", "b", "\rc" });
+        CHECK(tokens(embit::split(embit::cstring("aXaXYb"), "XY")) == std::vector<std::string>{ "aXa", "b" });
+        CHECK(tokens(embit::split(embit::cstring("abc"), "")) == std::vector<std::string>{ "abc" });
+    }
+
+    SECTION("Empty tokens") {
+        CHECK(tokens(embit::split(embit::cstring(",a,,b,"), ',')) == std::vector<std::string>{ "", "a", "", "b", "" });
+        CHECK(tokens(embit::split(embit::cstring(""), ',')).empty());
+        CHECK(tokens(embit::split(embit::cstring(","), ',')) == std::vector<std::string>{ "", "" });
+    }
+
+    SECTION("Tokens point into the source") {
+        const std::string str = "key=value";
+        auto split = embit::split(str, '=');
+        auto it = split.begin();
+        CHECK((*it).begin().get() == str.data());
+        ++it;
+        CHECK((*it).begin().get() == str.data() + 4);
+        CHECK((*it).size() == 5);
+    }
+
+    SECTION("Contiguous sources") {
+        const std::vector<char> chars{ 'x', ' ', 'y' };
+        CHECK(tokens(embit::split(chars, ' ')) == std::vector<std::string>{ "x", "y" });
+        CHECK(tokens(embit::split(std::string("1 2 3"), ' ')) == std::vector<std::string>{ "1", "2", "3" });
+        CHECK(tokens(embit::split(embit::cstring("a b c", 3), ' ')) == std::vector<std::string>{ "a", "b" });
+    }
+
+    SECTION("Wide characters") {
+        const auto split = embit::split(embit::cstring(L"ab--cd"), L"--");
+        CHECK(split.distance() == 2);
+        CHECK((*split.begin()).collectAs<std::wstring>() == L"ab");
+    }
+}
+
+TEST_CASE("Split composes with other views") {
+    SECTION("Internal iteration") {
+        const auto lengths = embit::chain(embit::split(embit::cstring("one two three"), ' '))
+                                 .map([](const embit::CStringView<char, embit::detail::CStringIterator<char>> token) {
+                                     return token.size();
+                                 })
+                                 .collectAs<std::vector<std::size_t>>();
+        CHECK(lengths == std::vector<std::size_t>{ 3, 3, 5 });
+    }
+
+    SECTION("Chain") {
+        const std::string lines = "a=1\nb=2\n\nc=3";
+        using Line = embit::CStringView<char, embit::detail::CStringIterator<char>>;
+        const auto count = embit::chain(lines).split('\n').filter([](const Line line) { return !line.empty(); }).distance();
+        CHECK(count == 3);
+        CHECK(embit::chain(embit::cstring("a::b")).split("::").distance() == 2);
+    }
+
+    SECTION("Stops early") {
+        const auto first = embit::chain(embit::cstring("a,b,c")).split(',').take(2).distance();
+        CHECK(first == 2);
+    }
+}
@@ -0,0 +1,77 @@
+#include <array>
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/StaticVector.hpp>
+#include <forward_list>
+#include <list>
+#include <vector>
+
+namespace {
+constexpr int values[] = { 1, 2, 3, 4, 5 };
+
+EMBIT_CONSTEXPR_CXX_14 int sumOfFirstThree() {
+    embit::StaticVector<int, 3> buffer;
+    embit::take(values, 4).collectInto(buffer);
+    int sum = 0;
+    for (const int i : buffer) {
+        sum += i;
+    }
+    return sum;
+}
+} // namespace
+
+TEST_CASE("Collecting into fixed capacity storage does not allocate") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+
+    SECTION("StaticVector") {
+        embit::StaticVector<int, 8> buffer = { 9 };
+        const auto result = embit::chain(v).map([](const int i) { return i * 2; }).collectInto(buffer);
+        CHECK(result.written == 5);
+        CHECK(!result.truncated);
+        CHECK(buffer == embit::StaticVector<int, 8>{ 9, 2, 4, 6, 8, 10 });
+
+        const auto truncated = embit::view(v).collectInto(buffer);
+        CHECK(truncated.written == 2);
+        CHECK(truncated.truncated);
+        CHECK(buffer.full());
+        CHECK(buffer.back() == 2);
+        CHECK(!buffer.push_back(3));
+    }
+
+    SECTION("Arrays are overwritten from the start") {
+        int array[3] = {};
+        const auto result = embit::view(v).collectInto(array);
+        CHECK(result.written == 3);
+        CHECK(result.truncated);
+        CHECK(array[2] == 3);
+
+        std::array<int, 8> stdArray{};
+        const auto partial = embit::chain(std::list<int>(v.begin(), v.end())).collectInto(stdArray);
+        CHECK(partial.written == 5);
+        CHECK(!partial.truncated);
+        CHECK(stdArray[4] == 5);
+        CHECK(stdArray[5] == 0);
+    }
+
+    SECTION("collectAs") {
+        CHECK(embit::view(v).collectAs<std::array<int, 2>>() == std::array<int, 2>{ { 1, 2 } });
+        CHECK(embit::view(v).collectAs<std::array<int, 6>>() == std::array<int, 6>{ { 1, 2, 3, 4, 5, 0 } });
+        CHECK(embit::view(v).collectAs<embit::StaticVector<int, 4>>() == embit::StaticVector<int, 4>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Containers without push_back or insert are not bounded") {
+        const std::forward_list<int> expected(v.begin(), v.end());
+        CHECK(embit::view(v).collectAs<std::forward_list<int>>() == expected);
+        CHECK(embit::chain(std::list<int>(v.begin(), v.end())).collectAs<std::forward_list<int>>() == expected);
+    }
+
+    SECTION("Constant expressions") {
+        constexpr auto collected = embit::view(values).collectAs<embit::StaticVector<int, 4>>();
+        static_assert(collected.size() == 4 && collected.back() == 4, "StaticVector should be filled at compile time");
+        static_assert(sumOfFirstThree() == 6, "collectInto should be usable at compile time");
+#ifdef EMBIT_HAS_CXX_17
+        constexpr auto array = embit::view(values).collectAs<std::array<int, 2>>();
+        static_assert(array[1] == 2, "std::array should be filled at compile time");
+#endif // EMBIT_HAS_CXX_17
+    }
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Join.hpp>
+#include <embit/Stream.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef EMBIT_HAS_POSIX
+#    include <cstdio>
+#endif // EMBIT_HAS_POSIX
+
+TEST_CASE("Stream reads istreams through a fixed buffer") {
+    SECTION("Reads everything across refills") {
+        std::istringstream input("hello stream world");
+        // Smaller than the input, so that the buffer is refilled several times
+        auto stream = embit::readStream(input, 4);
+        CHECK(stream.collectAs<std::string>() == "hello stream world");
+    }
+
+    SECTION("Empty input") {
+        std::istringstream input("");
+        auto stream = embit::readStream(input, 4);
+        CHECK(stream.empty());
+        CHECK(stream.collectAs<std::string>().empty());
+    }
+
+    SECTION("Whitespace is kept") {
+        std::istringstream input(" a\tb\n");
+        CHECK(embit::readStream(input, 2).collectAs<std::string>() == " a\tb\n");
+    }
+
+    SECTION("Caller provided buffer") {
+        std::istringstream input("0123456789");
+        char buffer[3];
+        CHECK(embit::readStream(input, buffer, sizeof buffer).collectAs<std::string>() == "0123456789");
+    }
+
+    SECTION("Iterating by hand") {
+        std::istringstream input("abcdef");
+        auto stream = embit::readStream(input, 4);
+        std::string result;
+        for (auto it = stream.begin(); it != stream.end(); ++it) {
+            result += *it;
+        }
+        CHECK(result == "abcdef");
+    }
+
+    SECTION("Single pass: a stopped iteration resumes after the last consumed element") {
+        std::istringstream input("abcdefgh");
+        auto stream = embit::readStream(input, 3);
+        CHECK(embit::chain(stream).take(5).collectAs<std::string>() == "abcde");
+        CHECK(stream.collectAs<std::string>() == "fgh");
+    }
+}
+
+TEST_CASE("Stream composes with other views") {
+    SECTION("Map and filter") {
+        std::istringstream input("a1b2c3");
+        auto digits = embit::chain(embit::readStream(input, 4))
+                          .filter([](const char c) { return c >= '0' && c <= '9'; })
+                          .map([](const char c) { return c - '0'; })
+                          .collectAs<std::vector<int>>();
+        CHECK(digits == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Take") {
+        std::istringstream input("abcdefgh");
+        CHECK(embit::chain(embit::readStream(input, 2)).take(3).collectAs<std::string>() == "abc");
+    }
+
+    SECTION("Join") {
+        std::istringstream input("xyz");
+        auto stream = embit::readStream(input, 2);
+        CHECK(embit::join(stream, ", ").collectAs<std::string>() == "x, y, z");
+    }
+}
+
+#ifdef EMBIT_HAS_POSIX
+TEST_CASE("Stream reads file descriptors through a fixed buffer") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    std::string contents;
+    for (int i = 0; i < 1000; ++i) {
+        contents += static_cast<char>('a' + i % 26);
+    }
+    REQUIRE(std::fwrite(contents.data(), 1, contents.size(), file) == contents.size());
+    REQUIRE(std::fflush(file) == 0);
+    const int fd = fileno(file);
+
+    SECTION("Reads everything across refills") {
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        CHECK(embit::readFd(fd, 64).collectAs<std::string>() == contents);
+    }
+
+    SECTION("Caller provided buffer") {
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        char buffer[7];
+        auto count =
+            embit::chain(embit::readFd(fd, buffer, sizeof buffer)).filter([](const char c) { return c == 'a'; }).distance();
+        CHECK(count == 39);
+    }
+
+    SECTION("Read errors throw") {
+        CHECK_THROWS_AS(embit::readFd(-1, 8).collectAs<std::string>(), std::system_error);
+    }
+
+    std::fclose(file);
+}
+#endif // EMBIT_HAS_POSIX
@@ -0,0 +1,73 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Take.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("Take is sized and stops at the end of the source") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+
+    SECTION("Random access") {
+        auto taken = embit::take(v, 3);
+        static_assert(embit::detail::IsRandomAccessView<decltype(taken)>::value, "Take over vector should be random access");
+        CHECK(taken.size() == 3);
+        CHECK(taken.distance() == 3);
+        CHECK(taken.back() == 3);
+        CHECK(embit::take(v, 10).size() == 5);
+        CHECK(embit::take(embit::map(v, [](const int i) { return i * 2; }), 2).begin()[1] == 4);
+    }
+
+    SECTION("Forward") {
+        std::list<int> l = { 1, 2, 3 };
+        CHECK(embit::take(l, 10).distance() == 3);
+        CHECK(embit::take(l, 2).distance() == 2);
+    }
+
+    SECTION("Slice") {
+        auto sliced = embit::slice(v, 1, 3);
+        CHECK(sliced.distance() == 2);
+        CHECK(sliced.front() == 2);
+        CHECK(embit::slice(v, 4, 10).distance() == 1);
+    }
+
+    SECTION("Negative amounts are empty") {
+        auto none = embit::take(v, -1);
+        CHECK(none.size() == 0);
+        CHECK(none.distance() == 0);
+        CHECK(none.empty());
+        CHECK(embit::reverse(none).collectAs<std::vector<int>>().empty());
+
+        auto reversed = embit::slice(v, 5, 2);
+        CHECK(reversed.size() == 0);
+        CHECK(reversed.distance() == 0);
+        CHECK(embit::reverse(reversed).collectAs<std::vector<int>>().empty());
+        CHECK(embit::slice(v, -2, 2).collectAs<std::vector<int>>() == std::vector<int>{ 1, 2 });
+        CHECK(embit::slice(std::list<int>(v.begin(), v.end()), 3, 1).distance() == 0);
+    }
+}
+
+TEST_CASE("Nested adaptors store the end of the underlying range once") {
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6 };
+    using VectorIterator = std::vector<int>::iterator;
+
+    SECTION("Take counts down instead of storing an end iterator") {
+        auto nested = embit::chain(v).take(5).take(4).take(3);
+        static_assert(sizeof(nested.begin()) == sizeof(VectorIterator) + 3 * sizeof(std::ptrdiff_t),
+                      "Every take should only add a counter");
+        CHECK(nested.distance() == 3);
+        CHECK(nested.back() == 3);
+        CHECK(embit::reverse(nested).collectAs<std::vector<int>>() == std::vector<int>{ 3, 2, 1 });
+        CHECK(embit::chain(v).slice(1, 5).slice(1, 3).collectAs<std::vector<int>>() == std::vector<int>{ 3, 4 });
+    }
+
+#if EMBIT_HAS_ATTRIBUTE(no_unique_address)
+    SECTION("Default sentinels take up no space") {
+        const auto timesTwo = [](const int i) { return i * 2; };
+        const auto isEven = [](const int i) { return i % 4 == 0; };
+        const auto plusOne = [](const int i) { return i + 1; };
+        auto pipeline = embit::chain(v).map(timesTwo).filter(isEven).map(plusOne);
+        static_assert(sizeof(pipeline.begin()) == 2 * sizeof(VectorIterator), "Only the vector's end should be stored");
+        CHECK(pipeline.collectAs<std::vector<int>>() == std::vector<int>{ 5, 9, 13 });
+    }
+#endif
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Concat.hpp>
+#include <embit/ToArray.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace {
+constexpr std::uint8_t bytes[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+constexpr std::uint8_t crc8(std::uint8_t crc) {
+    for (int bit = 0; bit < 8; ++bit) {
+        crc = static_cast<std::uint8_t>((crc & 0x80) != 0 ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+    return crc;
+}
+
+constexpr int square(const int i) {
+    return i * i;
+}
+
+constexpr bool isOdd(const int i) {
+    return i % 2 != 0;
+}
+} // namespace
+
+TEST_CASE("toArray materializes views") {
+#ifdef EMBIT_HAS_CXX_17
+    SECTION("Compile time lookup tables") {
+        constexpr auto crcTable = embit::toArray<8>(embit::map(bytes, crc8));
+        static_assert(crcTable[1] == 0x07 && crcTable[7] == 0x15, "CRC table should be generated at compile time");
+
+        constexpr auto oddSquares = embit::toArray<3>(embit::chain(bytes).map(square).filter(isOdd).take(3));
+        static_assert(oddSquares[0] == 1 && oddSquares[1] == 9 && oddSquares[2] == 25,
+                      "Pipelines should be evaluated at compile time");
+
+        constexpr auto concatenated = embit::toArray<4>(embit::concat(embit::take(bytes, 2), embit::slice(bytes, 6, 8)));
+        static_assert(concatenated[2] == 6 && concatenated[3] == 7, "Concat should be evaluated at compile time");
+
+        constexpr auto lambdas = embit::toArray<2>(embit::chain(bytes).take(2).map([](const std::uint8_t b) { return b * 3; }));
+        static_assert(lambdas[1] == 3, "Lambdas should be usable at compile time");
+    }
+#endif // EMBIT_HAS_CXX_17
+
+    SECTION("Run time") {
+        const std::vector<int> v = { 1, 2, 3 };
+        CHECK(embit::toArray<3>(embit::map(v, square)) == std::array<int, 3>{ { 1, 4, 9 } });
+        CHECK(embit::toArray<2>(v) == std::array<int, 2>{ { 1, 2 } });
+        CHECK(embit::toArray<4>(v) == std::array<int, 4>{ { 1, 2, 3, 0 } });
+    }
+}
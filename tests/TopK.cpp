@@ -0,0 +1,66 @@
+#include <array>
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Stream.hpp>
+#include <embit/TopK.hpp>
+#include <functional>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("TopK selects the greatest elements") {
+    const std::vector<int> values{ 5, 1, 9, 3, 7, 9, 2, 8 };
+
+    SECTION("Static storage") {
+        const auto top = embit::topK<3>(values);
+        CHECK(top == embit::StaticVector<int, 3>{ 9, 9, 8 });
+        const auto bottom = embit::bottomK<3>(values);
+        CHECK(bottom == embit::StaticVector<int, 3>{ 1, 2, 3 });
+    }
+
+    SECTION("Fewer elements than k") {
+        const std::list<int> few{ 2, 4 };
+        CHECK(embit::topK<5>(few) == embit::StaticVector<int, 5>{ 4, 2 });
+        CHECK(embit::topK<5>(std::vector<int>()).empty());
+        CHECK(embit::topK<0>(values).empty());
+    }
+
+    SECTION("Custom comparison") {
+        const std::vector<std::string> words{ "a", "ccc", "bb", "dddd" };
+        const auto shorter = [](const std::string& a, const std::string& b) { return a.size() < b.size(); };
+        const auto longest = embit::topK<2>(words, shorter);
+        CHECK(longest == embit::StaticVector<std::string, 2>{ "dddd", "ccc" });
+        CHECK(embit::topK<2>(values, std::greater<>()) == embit::StaticVector<int, 2>{ 1, 2 });
+    }
+
+    SECTION("Caller provided storage") {
+        std::array<int, 4> storage{};
+        CHECK(embit::topKInto(values, storage) == 4);
+        CHECK(storage == std::array<int, 4>{ 9, 9, 8, 7 });
+        int raw[2];
+        CHECK(embit::bottomKInto(values, raw) == 2);
+        CHECK(raw[0] == 1);
+        CHECK(raw[1] == 2);
+
+        std::array<int, 10> large{};
+        CHECK(embit::topKInto(values, large) == values.size());
+        CHECK(large[0] == 9);
+        CHECK(large[7] == 1);
+    }
+
+    SECTION("Single pass sources") {
+        std::istringstream input("the quick brown fox");
+        CHECK(embit::topK<3>(embit::readStream(input, 4)) == embit::StaticVector<char, 3>{ 'x', 'w', 'u' });
+        CHECK(embit::bottomK<2>(embit::cstring("hello")) == embit::StaticVector<char, 2>{ 'e', 'h' });
+    }
+
+    SECTION("Chain") {
+        const auto top = embit::chain(values).map([](const int i) { return i * 10; }).topK<2>();
+        CHECK(top == embit::StaticVector<int, 2>{ 90, 90 });
+        CHECK(embit::chain(values).bottomK<1>() == embit::StaticVector<int, 1>{ 1 });
+        embit::StaticVector<int, 2> storage;
+        CHECK(embit::chain(values).filter([](const int i) { return i % 2 == 1; }).topKInto(storage) == 2);
+        CHECK(storage == embit::StaticVector<int, 2>{ 9, 9 });
+    }
+}
@@ -0,0 +1,49 @@
+#include <catch2/catch.hpp>
+#include <embit/Chain.hpp>
+#include <embit/Zip.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("Zip iterates views in lockstep") {
+    std::vector<int> timestamps = { 10, 20, 30, 40 };
+    std::vector<double> values = { 1.5, 2.5, 3.5 };
+    const bool flags[] = { true, false, true, true, false };
+
+    SECTION("Random access") {
+        auto zipped = embit::zip(timestamps, values, flags);
+        static_assert(embit::detail::IsRandomAccessView<decltype(zipped)>::value, "Zip of vectors should be random access");
+        static_assert(std::is_same<decltype(*zipped.begin()), std::tuple<int&, double&, const bool&>>::value,
+                      "Zip should yield references");
+        CHECK(zipped.size() == 3);
+        CHECK(zipped.distance() == 3);
+        CHECK(zipped.begin()[1] == std::make_tuple(20, 2.5, false));
+        CHECK(zipped.back() == std::make_tuple(30, 3.5, true));
+        CHECK(embit::reverse(zipped).front() == std::make_tuple(30, 3.5, true));
+    }
+
+    SECTION("Writes through references") {
+        for (auto it = embit::zip(timestamps, values).begin(); it != embit::defaultSentinel; ++it) {
+            std::get<1>(*it) += std::get<0>(*it);
+        }
+        CHECK(values == std::vector<double>{ 11.5, 22.5, 33.5 });
+    }
+
+    SECTION("Composes with map and filter") {
+        using Row = std::tuple<int&, double&, const bool&>;
+        const auto sum = embit::chain(timestamps)
+                             .zip(values, flags)
+                             .filter([](const Row& row) { return std::get<2>(row); })
+                             .map([](const Row& row) { return std::get<0>(row) * std::get<1>(row); })
+                             .foldl([](const double acc, const double d) { return acc + d; }, 0.0);
+        CHECK(sum == Approx(10 * 1.5 + 30 * 3.5));
+    }
+
+    SECTION("Forward") {
+        std::list<int> l = { 1, 2, 3, 4, 5 };
+        auto zipped = embit::zip(l, timestamps);
+        CHECK(zipped.distance() == 4);
+        CHECK(embit::zip(timestamps, l).collectAs<std::vector<std::tuple<int, int>>>() ==
+              std::vector<std::tuple<int, int>>{ { 10, 1 }, { 20, 2 }, { 30, 3 }, { 40, 4 } });
+        CHECK(embit::zip(l, std::vector<int>()).empty());
+    }
+}